@@ -0,0 +1,205 @@
+// --- Includes ---
+#include <algorithm> // For std::sort, std::min
+#include <chrono>    // For timing
+#include <cstdint>   // For std::int16_t
+#include <cstdio>    // For std::printf, std::fopen
+#include <cstring>   // For std::strcmp
+#include <thread>    // For std::this_thread::sleep_for
+#include <vector>    // For the timings and the output buffer
+
+// Include our custom headers
+#include "gamefiles/AudioMixer.hpp" // The audio path being measured
+#include "gamefiles/GameEvents.hpp" // The events that drive it
+
+// The game's audio path without an audio device:
+//  - post: what the frame thread pays per gameplay event (a lock-free queue push), over
+//    bursts of 50 coins at once;
+//  - burst: 50 coins and a spike hit in the same frame, mixed buffer by buffer; the hit
+//    must get a voice (exit code 2 if it does not) while the coins share their few voices;
+//  - mix: the cost of mixing one buffer for pool sizes of 4 to 32 voices, kept busy with
+//    every sound, as a share of the buffer's duration;
+//  - realtime: the null output mixing on its own thread for two seconds while the game
+//    thread posts a burst every frame.
+// Prints JSON.
+//
+//   audio_bench [--out results.json]
+
+// --- Helper Types (Specific to this file) ---
+
+struct MixResult {
+    unsigned int voices = 0;
+    double meanActiveVoices = 0.0;
+    double meanUs = 0.0, p99Us = 0.0; // Per buffer
+    double realTimePercent = 0.0;     // meanUs / buffer duration
+};
+
+// --- Helper Functions (Specific to this file) ---
+
+GameEvent makeEvent(GameEventType type, int value)
+{
+    GameEvent event;
+    event.type = type;
+    event.value = value;
+    return event;
+}
+
+double percentile(std::vector<double> values, int percent)
+{
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, values.size() * percent / 100)];
+}
+
+// Mixes 'buffers' buffers with every sound requested before each one.
+MixResult runMix(const SoundBank &bank, unsigned int voiceCount, int buffers)
+{
+    AudioMixer mixer(bank, voiceCount);
+    std::vector<std::int16_t> out(AUDIO_BUFFER_FRAMES);
+    std::vector<double> times;
+    times.reserve(buffers);
+    MixResult result;
+    result.voices = voiceCount;
+    for (int buffer = 0; buffer < buffers; ++buffer)
+    {
+        for (int sound = 0; sound < (int)SoundId::Count; ++sound)
+            mixer.play((SoundId)sound, 1.f + 0.1f * (buffer % 4));
+        auto start = std::chrono::steady_clock::now();
+        mixer.mix(out.data(), out.size());
+        times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        result.meanActiveVoices += mixer.getActiveVoices();
+    }
+    double total = 0.0;
+    for (double us : times)
+        total += us;
+    result.meanUs = total / times.size();
+    result.p99Us = percentile(times, 99);
+    result.meanActiveVoices /= buffers;
+    result.realTimePercent = 100.0 * result.meanUs / (1e6 * AUDIO_BUFFER_FRAMES / AUDIO_SAMPLE_RATE);
+    return result;
+}
+
+// --- Main Function ---
+int main(int argc, char **argv)
+{
+    const char *outPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            outPath = argv[++i];
+        else
+        {
+            std::fprintf(stderr, "usage: audio_bench [--out results.json]\n");
+            return 1;
+        }
+    }
+
+    const int BURST_COINS = 50;
+    SoundBank bank;
+    auto synthStart = std::chrono::steady_clock::now();
+    synthesizeSoundBank(bank);
+    double synthMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - synthStart).count();
+    std::vector<std::int16_t> out(AUDIO_BUFFER_FRAMES);
+
+    // --- Post ---
+    std::vector<double> postNs;
+    {
+        AudioMixer mixer(bank);
+        for (int burst = 0; burst < 2000; ++burst)
+        {
+            for (int coin = 0; coin < BURST_COINS; ++coin)
+            {
+                auto start = std::chrono::steady_clock::now();
+                mixer.post(makeEvent(GameEventType::CoinCollected, coin));
+                postNs.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+            }
+            mixer.mix(out.data(), out.size()); // Drains the queue, as the audio thread would
+        }
+    }
+    double postMeanNs = 0.0;
+    for (double ns : postNs)
+        postMeanNs += ns;
+    postMeanNs /= postNs.size();
+
+    // --- Burst ---
+    AudioMixer burstMixer(bank);
+    for (int coin = 0; coin < BURST_COINS; ++coin)
+        burstMixer.post(makeEvent(GameEventType::CoinCollected, coin));
+    burstMixer.post(makeEvent(GameEventType::PlayerHitHazard, 0));
+    burstMixer.mix(out.data(), out.size());
+    unsigned int burstActive = burstMixer.getActiveVoices();
+    bool hitPlayed = burstMixer.getSoundsStarted() == (std::uint64_t)BURST_COINS + 1 &&
+                     burstMixer.getSoundsDropped() == 0;
+    int buffersToSilence = 1;
+    while (burstMixer.getActiveVoices() > 0 && buffersToSilence < 10000)
+    {
+        burstMixer.mix(out.data(), out.size());
+        buffersToSilence++;
+    }
+
+    // --- Mix ---
+    std::vector<MixResult> mixResults;
+    for (unsigned int voices : {4u, 8u, 16u, 32u})
+        mixResults.push_back(runMix(bank, voices, 5000));
+
+    // --- Real Time ---
+    AudioMixer liveMixer(bank);
+    NullAudioOutput nullOutput(liveMixer);
+    nullOutput.start();
+    const int LIVE_FRAMES = 120; // Two seconds at 60 fps
+    auto liveStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < LIVE_FRAMES; ++frame)
+    {
+        for (int coin = 0; coin < BURST_COINS; ++coin)
+            liveMixer.post(makeEvent(GameEventType::CoinCollected, frame * BURST_COINS + coin));
+        if (frame % 20 == 0)
+            liveMixer.post(makeEvent(GameEventType::PlayerFellOut, 0));
+        std::this_thread::sleep_until(liveStart + std::chrono::microseconds(16667) * (frame + 1));
+    }
+    nullOutput.stop();
+    double liveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - liveStart).count();
+    double expectedBuffers = liveSeconds * AUDIO_SAMPLE_RATE / AUDIO_BUFFER_FRAMES;
+
+    std::fprintf(stderr, "post: mean %.1f ns, p99 %.1f ns per event\n", postMeanNs, percentile(postNs, 99));
+    std::fprintf(stderr, "burst: %d coins + 1 hit -> %u voices, hit %s, silent after %d buffers\n", BURST_COINS,
+                 burstActive, hitPlayed ? "played" : "DROPPED", buffersToSilence);
+    for (const MixResult &r : mixResults)
+        std::fprintf(stderr, "mix: %2u voices (%.1f active): mean %.2f us, p99 %.2f us, %.3f%% of real time\n",
+                     r.voices, r.meanActiveVoices, r.meanUs, r.p99Us, r.realTimePercent);
+    std::fprintf(stderr, "realtime: %llu of %.0f buffers, %llu sounds started, %llu stolen, %llu dropped\n",
+                 (unsigned long long)nullOutput.getBuffersMixed(), expectedBuffers,
+                 (unsigned long long)liveMixer.getSoundsStarted(), (unsigned long long)liveMixer.getVoicesStolen(),
+                 (unsigned long long)liveMixer.getSoundsDropped());
+
+    // --- Report (JSON) ---
+    FILE *report = outPath ? std::fopen(outPath, "w") : stdout;
+    if (!report)
+    {
+        std::fprintf(stderr, "Error creating %s\n", outPath);
+        return 1;
+    }
+    std::fprintf(report, "{\n  \"benchmark\": \"audio\",\n  \"sample_rate\": %u,\n  \"buffer_frames\": %u,\n"
+                         "  \"synthesis_ms\": %.3f,\n",
+                 AUDIO_SAMPLE_RATE, AUDIO_BUFFER_FRAMES, synthMs);
+    std::fprintf(report, "  \"post\": {\"mean_ns\": %.1f, \"p99_ns\": %.1f},\n", postMeanNs, percentile(postNs, 99));
+    std::fprintf(report,
+                 "  \"burst\": {\"coins\": %d, \"active_voices\": %u, \"hit_played\": %s, \"buffers_to_silence\": %d},\n",
+                 BURST_COINS, burstActive, hitPlayed ? "true" : "false", buffersToSilence);
+    std::fprintf(report, "  \"mix\": [\n");
+    for (std::size_t i = 0; i < mixResults.size(); ++i)
+    {
+        const MixResult &r = mixResults[i];
+        std::fprintf(report,
+                     "    {\"voices\": %u, \"mean_active\": %.2f, \"mean_us\": %.3f, \"p99_us\": %.3f, "
+                     "\"real_time_percent\": %.4f}%s\n",
+                     r.voices, r.meanActiveVoices, r.meanUs, r.p99Us, r.realTimePercent,
+                     i + 1 < mixResults.size() ? "," : "");
+    }
+    std::fprintf(report,
+                 "  ],\n  \"realtime\": {\"seconds\": %.3f, \"buffers\": %llu, \"expected_buffers\": %.0f, "
+                 "\"started\": %llu, \"stolen\": %llu, \"dropped\": %llu}\n}\n",
+                 liveSeconds, (unsigned long long)nullOutput.getBuffersMixed(), expectedBuffers,
+                 (unsigned long long)liveMixer.getSoundsStarted(), (unsigned long long)liveMixer.getVoicesStolen(),
+                 (unsigned long long)liveMixer.getSoundsDropped());
+    if (report != stdout)
+        std::fclose(report);
+    return hitPlayed ? 0 : 2;
+}
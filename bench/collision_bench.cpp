@@ -0,0 +1,199 @@
+// --- Includes ---
+#include <chrono>   // For timing
+#include <cmath>    // For std::cos, std::sin, std::ceil
+#include <algorithm> // For std::max
+#include <cstdio>   // For std::printf
+#include <random>   // For reproducible body placement
+#include <vector>   // For the body lists
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"     // TILE_SIZE, COLLISION_EPSILON
+#include "gamefiles/Level.hpp"         // Level
+#include "gamefiles/TileCollision.hpp" // The two resolvers being compared
+
+// Micro-benchmark: the original probe resolver vs. the swept resolver at several speeds.
+// For each speed it reports the cost per call and how many bodies tunnelled, i.e. ended
+// up inside or on the far side of a solid tile without the resolver reporting contact.
+// The swept resolver is timed with and without the level's solidity index. A second table
+// compares "first solid tile along a row" scans of several lengths, tile by tile vs. the
+// index's word scans.
+//
+// At ordinary speeds (2-5 px/tick) the swept resolver costs about 17 ns per call against
+// the probe's 14.5, some 20% more. The difference is accepted: the probe reads one row and
+// one column, while the sweep must also work out which rows and columns the body enters,
+// and the extra branches cost about as much as the tile reads themselves. A separate path
+// for bodies that cross no tile boundary measured no faster, because it needs the same tile
+// indexes to tell whether a body crosses. The probe also tunnels from 5 px/tick on and
+// ignores one-way platforms.
+
+// --- Helper Types and Functions (Specific to this file) ---
+
+using Resolver = void (*)(const Level &, sf::Vector2f &, sf::Vector2f, sf::Vector2f &, bool &);
+
+// A body about to be resolved: start of tick state.
+struct Body
+{
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+};
+
+const sf::Vector2f HALF_SIZE = {TILE_SIZE * 0.4f, TILE_SIZE * 0.475f}; // Same box as the Player
+
+// A wide level with one-tile-thick platforms and walls: the worst case for tunnelling.
+Level makeBenchLevel()
+{
+    Level level;
+    level.resize({1024, 128});
+    for (int y = 0; y < (int)level.size.y; ++y)
+    {
+        for (int x = 0; x < (int)level.size.x; ++x)
+        {
+            bool platform = y % 8 == 7 && x % 32 < 24;
+            bool wall = x % 16 == 15 && y % 32 < 20;
+            if (platform || wall)
+                level.tiles.at(x, y) = TileType::Solid;
+        }
+    }
+    level.rebuildTileIndexes();
+    return level;
+}
+
+// Does the box centered at 'center' overlap any solid tile?
+bool overlapsSolid(const Level &level, sf::Vector2f center)
+{
+    int x0 = (int)std::floor((center.x - HALF_SIZE.x + COLLISION_EPSILON) / TILE_SIZE);
+    int x1 = (int)std::floor((center.x + HALF_SIZE.x - COLLISION_EPSILON) / TILE_SIZE);
+    int y0 = (int)std::floor((center.y - HALF_SIZE.y + COLLISION_EPSILON) / TILE_SIZE);
+    int y1 = (int)std::floor((center.y + HALF_SIZE.y - COLLISION_EPSILON) / TILE_SIZE);
+    // Tile by tile on purpose: the reference must not share code with what it checks.
+    for (int y = y0; y <= y1; ++y)
+        for (int x = x0; x <= x1; ++x)
+            if (hasTileFlag(level.getTile(x, y), TILE_SOLID))
+                return true;
+    return false;
+}
+
+// Does the box hit a solid tile anywhere on the straight path from 'from' to 'to'?
+bool pathHitsSolid(const Level &level, sf::Vector2f from, sf::Vector2f to)
+{
+    sf::Vector2f delta = to - from;
+    int steps = (int)std::ceil(std::max(std::abs(delta.x), std::abs(delta.y)) / 2.f) + 1;
+    for (int i = 1; i <= steps; ++i)
+        if (overlapsSolid(level, from + delta * ((float)i / steps)))
+            return true;
+    return false;
+}
+
+// Random free positions with velocity of length 'speed' in a random direction.
+std::vector<Body> makeBodies(const Level &level, float speed, std::size_t count)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> xs(TILE_SIZE, level.sizePixels.x - TILE_SIZE);
+    std::uniform_real_distribution<float> ys(TILE_SIZE, level.sizePixels.y - TILE_SIZE);
+    std::uniform_real_distribution<float> angles(0.f, 6.2831853f);
+    std::vector<Body> bodies;
+    while (bodies.size() < count)
+    {
+        sf::Vector2f position = {xs(rng), ys(rng)};
+        if (overlapsSolid(level, position))
+            continue;
+        float angle = angles(rng);
+        bodies.push_back({position, {std::cos(angle) * speed, std::sin(angle) * speed}});
+    }
+    return bodies;
+}
+
+// Runs 'resolver' over all bodies 'passes' times; returns nanoseconds per call and counts
+// bodies whose resolved motion passes through a solid tile.
+double measure(Resolver resolver, const Level &level, const std::vector<Body> &bodies, int passes, int &tunnelled)
+{
+    float checksum = 0.f; // Keeps the optimizer from dropping the work
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        for (const Body &body : bodies)
+        {
+            sf::Vector2f position = body.position;
+            sf::Vector2f velocity = body.velocity;
+            bool onGround = false;
+            resolver(level, position, HALF_SIZE, velocity, onGround);
+            checksum += position.x + velocity.y;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Correctness pass (untimed): follow each resolved motion in small steps, vertical then
+    // horizontal like the resolvers, and look for solid tiles along the way.
+    tunnelled = 0;
+    for (const Body &body : bodies)
+    {
+        sf::Vector2f position = body.position;
+        sf::Vector2f velocity = body.velocity;
+        bool onGround = false;
+        resolver(level, position, HALF_SIZE, velocity, onGround);
+        sf::Vector2f end = position + velocity;
+        sf::Vector2f corner = {body.position.x, end.y}; // After the vertical leg
+        if (pathHitsSolid(level, body.position, corner) || pathHitsSolid(level, corner, end))
+            tunnelled++;
+    }
+
+    std::printf("%s", checksum == 12345.f ? " " : ""); // Never true, but the compiler can't know
+    return seconds * 1e9 / ((double)passes * bodies.size());
+}
+
+// Nanoseconds per findTileInRow<TILE_SOLID>() call over 'queries' random rows and start columns,
+// scanning 'length' tiles to the right.
+double measureRowScan(const Level &level, int length, int queries)
+{
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> rows(0, (int)level.size.y - 1), columns(0, (int)level.size.x - 1);
+    std::vector<sf::Vector2i> starts(queries);
+    for (sf::Vector2i &start : starts)
+        start = {columns(rng), rows(rng)};
+
+    long long checksum = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (const sf::Vector2i &start : starts)
+        checksum += findTileInRow<TILE_SOLID>(level, start.y, start.x, start.x + length - 1);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::printf("%s", checksum == 12345 ? " " : "");
+    return seconds * 1e9 / queries;
+}
+
+// --- Main Function ---
+int main()
+{
+    const std::size_t BODY_COUNT = 20000;
+    const int PASSES = 50;
+    const float SPEEDS[] = {2.f, 5.f, 18.f, 39.f, 80.f, 160.f, 400.f}; // pixels/tick
+
+    const int ROW_SCAN_LENGTHS[] = {4, 64, 512, 1024};
+    const int ROW_SCAN_QUERIES = 1000000;
+
+    Level level = makeBenchLevel();
+    Level unindexed = level;
+    unindexed.solidity.clear(); // Same tiles, queries go tile by tile
+    std::printf("%8s | %14s %10s | %14s %10s | %16s\n", "speed", "probe ns/call", "tunnelled", "swept ns/call",
+                "tunnelled", "no index ns/call");
+    for (float speed : SPEEDS)
+    {
+        std::vector<Body> bodies = makeBodies(level, speed, BODY_COUNT);
+        int probeTunnelled = 0;
+        int sweptTunnelled = 0;
+        int unindexedTunnelled = 0;
+        double probeNs = measure(resolveTileCollisionProbe, level, bodies, PASSES, probeTunnelled);
+        double sweptNs = measure(resolveTileCollisionSwept, level, bodies, PASSES, sweptTunnelled);
+        double unindexedNs = measure(resolveTileCollisionSwept, unindexed, bodies, PASSES, unindexedTunnelled);
+        std::printf("%8.0f | %14.1f %10d | %14.1f %10d | %16.1f\n", speed, probeNs, probeTunnelled, sweptNs,
+                    sweptTunnelled, unindexedNs);
+    }
+
+    std::printf("\n%8s | %14s | %14s\n", "row scan", "tiles ns/call", "index ns/call");
+    for (int length : ROW_SCAN_LENGTHS)
+    {
+        double tilesNs = measureRowScan(unindexed, length, ROW_SCAN_QUERIES);
+        double indexNs = measureRowScan(level, length, ROW_SCAN_QUERIES);
+        std::printf("%8d | %14.1f | %14.1f\n", length, tilesNs, indexNs);
+    }
+    return 0;
+}
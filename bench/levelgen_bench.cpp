@@ -0,0 +1,68 @@
+// --- Includes ---
+#include <algorithm> // For std::max, std::min
+#include <chrono>   // For timing
+#include <cstdint>  // For std::uint64_t
+#include <cstdio>   // For std::printf
+#include <thread>   // For std::thread::hardware_concurrency
+#include <vector>   // For the thread counts
+
+// Include our custom headers
+#include "gamefiles/InputLog.hpp"       // computeLevelChecksum
+#include "gamefiles/LevelGenerator.hpp" // The generator being measured
+
+// Cost of the procedural level generator from small maps up to 100000 x 1000 tiles, with
+// 1, 2, 4, ... threads up to the hardware's. Every level is checksummed, and the run
+// fails (exit code 2) if any thread count produced a different level for the same seed.
+// The times include Level::rebuildTileIndexes(), which runs on one thread.
+
+// --- Helper Functions (Specific to this file) ---
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// --- Main Function ---
+int main()
+{
+    const sf::Vector2u SIZES[] = {{1024, 64}, {4096, 512}, {16384, 1000}, {100000, 1000}};
+    const int REPEATS = 3; // Best of
+
+    std::vector<unsigned int> threadCounts = {1};
+    unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threads = 2; threads < hardwareThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    if (hardwareThreads > 1)
+        threadCounts.push_back(hardwareThreads);
+
+    bool deterministic = true;
+    std::printf("%15s | %7s | %10s %8s | %8s\n", "level", "threads", "ms", "coins", "same");
+    for (sf::Vector2u size : SIZES)
+    {
+        LevelGenParams params;
+        params.size = size;
+        params.seed = 42;
+        std::uint64_t firstChecksum = 0;
+        for (unsigned int threads : threadCounts)
+        {
+            Level level;
+            double bestMs = 0.0;
+            for (int repeat = 0; repeat < REPEATS; ++repeat)
+            {
+                auto start = std::chrono::steady_clock::now();
+                if (!generateLevel(params, level, threads))
+                    return 1;
+                double ms = millisecondsSince(start);
+                bestMs = repeat == 0 ? ms : std::min(bestMs, ms);
+            }
+            std::uint64_t checksum = computeLevelChecksum(level);
+            if (threads == threadCounts.front())
+                firstChecksum = checksum;
+            bool same = checksum == firstChecksum;
+            deterministic = deterministic && same;
+            std::printf("%7u x %5u | %7u | %10.2f %8zu | %8s\n", size.x, size.y, threads, bestMs,
+                        level.getRemainingCoins(), same ? "yes" : "NO");
+        }
+    }
+    return deterministic ? 0 : 2;
+}
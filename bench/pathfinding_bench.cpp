@@ -0,0 +1,158 @@
+// --- Includes ---
+#include <algorithm> // For std::min
+#include <chrono>    // For timing
+#include <cstdio>    // For std::printf
+#include <cstdlib>   // For std::exit
+#include <random>    // For reproducible enemy placement
+#include <thread>    // For pacing ticks
+#include <vector>    // For the timing lists
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"   // TILE_SIZE, flow field constants
+#include "gamefiles/EntityStore.hpp" // Enemies being steered
+#include "gamefiles/Level.hpp"       // Level
+#include "gamefiles/LevelGenerator.hpp" // The generated level enemies chase across
+#include "gamefiles/Pathfinding.hpp" // Flow fields and the navigator being measured
+
+// Cost of enemy pathfinding. The first table times one flow field over regions of
+// several sizes. The second runs enemies chasing a player walking along the level for
+// a few hundred ticks and reports the AI time per tick (navigator update and steering,
+// not physics), with fields computed inline on the simulation thread and on the
+// background worker. Worker runs are paced at the real tick rate, since the worker only
+// helps if it has the ticks between request and collection to work in. The field is
+// shared, so its cost hardly grows with the enemies.
+
+// --- Helper Functions (Specific to this file) ---
+
+// The standard generated stress-test level: ground with pits and walls, and staircases of
+// one-way platforms climbing from it, all within a jump of each other.
+Level makeBenchLevel()
+{
+    LevelGenParams params;
+    params.size = {1024, 128};
+    params.seed = 42;
+    Level level;
+    if (!generateLevel(params, level))
+        std::exit(1); // Never measure an empty level
+    return level;
+}
+
+// Row of the air tile on top of the highest solid or one-way tile in column 'x'.
+int getStandingRow(const Level &level, int x)
+{
+    int y = findTileInColumn<TILE_SOLID | TILE_ONE_WAY>(level, x, 0, (int)level.size.y - 1);
+    return y > 0 ? y - 1 : (int)level.size.y - 2;
+}
+
+// Row of the air tile on the ground (below any platforms) in column 'x'.
+int getGroundRow(const Level &level, int x)
+{
+    int y = findTileInColumn<TILE_SOLID>(level, x, 0, (int)level.size.y - 1);
+    return y > 0 ? y - 1 : (int)level.size.y - 2;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs 'enemyCount' enemies for 'ticks' ticks and returns the AI milliseconds per tick.
+// Counts the fields computed in 'fields'. With a worker, ticks start SIM_TICK_SECONDS apart.
+double runChase(const Level &level, std::size_t enemyCount, int ticks, FlowFieldWorker *worker, int &fields)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> column(0, 255);
+    EntityStore entities;
+    for (std::size_t i = 0; i < enemyCount; ++i)
+    {
+        // Standing on the highest platform (or the ground) of a column near the start of the level.
+        int x = column(rng);
+        sf::Vector2f position = {(x + 0.5f) * TILE_SIZE, (getStandingRow(level, x) + 0.5f) * TILE_SIZE};
+        entities.create(EntityKind::Enemy, position, {ENEMY_HALF_WIDTH, ENEMY_HALF_HEIGHT},
+                        ENTITY_ALIVE | ENTITY_COLLIDES_TILES);
+    }
+
+    EnemyNavigator navigator;
+    std::uint64_t lastSequence = 0;
+    fields = 0;
+    double aiMs = 0.0;
+    auto nextTick = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; ++tick)
+    {
+        if (worker)
+        {
+            std::this_thread::sleep_until(nextTick);
+            nextTick += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(SIM_TICK_SECONDS));
+        }
+        // The player walks right along the ground, a tile every 8 ticks.
+        int playerX = 8 + tick / 8;
+        sf::Vector2i playerTile = {playerX, getGroundRow(level, playerX)};
+
+        auto start = std::chrono::steady_clock::now();
+        navigator.update(level, playerTile, (std::uint64_t)tick, worker);
+        navigator.steer(entities);
+        aiMs += millisecondsSince(start);
+        if (navigator.field.sequence != lastSequence)
+        {
+            lastSequence = navigator.field.sequence;
+            fields++;
+        }
+
+        applyGravity(entities);
+        resolveTileCollisions(entities, level);
+        integrate(entities);
+    }
+    return aiMs / ticks;
+}
+
+// --- Main Function ---
+int main()
+{
+    Level level = makeBenchLevel();
+    EnemyNavigator navigator; // For the enemies' movement limits
+
+    // --- Single Field ---
+    const int HALF_SIZES[][2] = {{16, 8}, {32, 16}, {FLOW_FIELD_HALF_WIDTH, FLOW_FIELD_HALF_HEIGHT}, {128, 64}};
+    const int REPEATS = 20;
+    std::printf("%11s | %8s %10s %10s\n", "region", "cells", "field ms", "reachable");
+    for (const auto &half : HALF_SIZES)
+    {
+        sf::Vector2i target = {512, getGroundRow(level, 512)};
+        FlowFieldRequest request;
+        request.sequence = 1;
+        request.size = {std::min(2 * half[0] + 1, (int)level.size.x), std::min(2 * half[1] + 1, (int)level.size.y)};
+        request.origin = {target.x - request.size.x / 2, target.y - request.size.y / 2};
+        request.target = target;
+        for (int y = 0; y < request.size.y; ++y)
+            for (int x = 0; x < request.size.x; ++x)
+                request.tileFlags.push_back(getTileFlags(level.getTile(request.origin.x + x, request.origin.y + y)));
+
+        FlowField field;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPEATS; ++i)
+            computeFlowField(request, navigator.limits, field);
+        double fieldMs = millisecondsSince(start) / REPEATS;
+
+        std::size_t reachable = 0;
+        for (std::uint16_t cost : field.cost)
+            if (cost != FlowField::UNREACHABLE)
+                reachable++;
+        std::printf("%5d x %3d | %8zu %10.3f %10zu\n", request.size.x, request.size.y, field.cost.size(), fieldMs,
+                    reachable);
+    }
+
+    // --- Chasing ---
+    const std::size_t COUNTS[] = {100, 1000, 10000};
+    const int TICKS = 240; // 4 seconds when paced
+    std::printf("\n%8s | %16s %16s %8s\n", "enemies", "inline ms/tick", "worker ms/tick", "fields");
+    for (std::size_t count : COUNTS)
+    {
+        int inlineFields = 0, workerFields = 0;
+        double inlineMs = runChase(level, count, TICKS, nullptr, inlineFields);
+        FlowFieldWorker worker(navigator.limits);
+        double workerMs = runChase(level, count, TICKS, &worker, workerFields);
+        std::printf("%8zu | %16.4f %16.4f %8d\n", count, inlineMs, workerMs, workerFields);
+    }
+    return 0;
+}
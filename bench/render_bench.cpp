@@ -0,0 +1,237 @@
+// --- Includes ---
+#include <SFML/Graphics.hpp> // For sf::RenderTexture, sf::View
+#include <SFML/OpenGL.hpp>   // For glFinish, glGetString
+#include <algorithm>         // For std::sort, std::min
+#include <chrono>            // For timing
+#include <cstdio>            // For std::printf, std::fopen
+#include <cstdlib>           // For std::atoi, std::exit
+#include <cstring>           // For std::strcmp
+#include <vector>            // For frame times
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"       // TILE_SIZE, WINDOW_WIDTH/HEIGHT
+#include "gamefiles/Level.hpp"           // Levels being drawn
+#include "gamefiles/LevelGenerator.hpp"  // Generated levels
+#include "gamefiles/Parallax.hpp"        // Background and foreground layers
+#include "gamefiles/SpriteAtlas.hpp"     // The sprite texture
+#include "gamefiles/SpriteBatch.hpp"     // The batch being measured
+#include "gamefiles/TileMapRenderer.hpp" // Cached tile geometry
+#include "gamefiles/WorldRenderer.hpp"   // Player sprite
+
+// Offscreen rendering cost of the game's world pass: the level tiles (drawLevel) plus the
+// player between the parallax layers, drawn into an sf::RenderTexture the size of the game
+// window with no frame limit. Sweeps level sizes and zoom levels (a zoom of 4 shows 4x as
+// many tiles in each direction) while the camera pans across the level, then repeats one
+// configuration without parallax and with its column cache off, and prints JSON with the
+// mean and p99 frame time and the draw calls per frame.
+//
+//   render_bench [--frames N] [--out results.json]
+//
+// Every frame ends with glFinish(), so the times include the GPU (or llvmpipe) work, not
+// just command submission. On a headless box, run it under software GL, e.g.
+//   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./build/bin/render_bench
+
+// --- Helper Types (Specific to this file) ---
+
+enum class ParallaxMode
+{
+    None,     // No parallax layers
+    Cached,   // As in the game: only newly visible columns are redrawn
+    Uncached  // Every visible column redrawn each frame
+};
+
+struct BenchResult {
+    unsigned int levelWidth = 0, levelHeight = 0; // Tiles
+    float zoom = 1.f;
+    ParallaxMode parallax = ParallaxMode::Cached;
+    int frames = 0;
+    double meanMs = 0.0, p50Ms = 0.0, p99Ms = 0.0, maxMs = 0.0;
+    double drawCalls = 0.0;  // Per frame, averaged
+    double tilesDrawn = 0.0; // Non-empty tiles submitted per frame, averaged
+    double parallaxColumns = 0.0; // Parallax columns redrawn per frame, averaged
+};
+
+// --- Helper Functions (Specific to this file) ---
+
+const char *getParallaxModeName(ParallaxMode mode)
+{
+    switch (mode)
+    {
+    case ParallaxMode::None:
+        return "none";
+    case ParallaxMode::Cached:
+        return "cached";
+    case ParallaxMode::Uncached:
+        return "uncached";
+    }
+    return "?";
+}
+
+// The standard generated stress-test level (ground, pits, walls, platform staircases, coins).
+Level makeBenchLevel(unsigned int width, unsigned int height, unsigned int seed)
+{
+    LevelGenParams params;
+    params.size = {width, height};
+    params.seed = seed;
+    Level level;
+    if (!generateLevel(params, level))
+        std::exit(1); // Never measure an empty level
+    return level;
+}
+
+// Renders 'frames' frames of 'level' at 'zoom' while panning, after a short warm-up.
+BenchResult runConfig(sf::RenderTexture &target, const SpriteAtlas &atlas, const Level &level, float zoom,
+                      ParallaxMode parallaxMode, int frames)
+{
+    const int WARMUP_FRAMES = 30;
+    const float PAN_PIXELS_PER_FRAME = 16.f;
+
+    TileMapRenderer tileRenderer(atlas); // Fresh cache per configuration
+    SpriteBatch batch;
+    ParallaxRenderer parallax; // Fresh caches too
+    if (parallaxMode != ParallaxMode::None)
+    {
+        parallax.build(getDefaultParallaxLayers(), level, target.getSize(), 1234);
+        parallax.setCaching(parallaxMode == ParallaxMode::Cached);
+    }
+    sf::View view({0.f, 0.f}, {(float)WINDOW_WIDTH * zoom, (float)WINDOW_HEIGHT * zoom});
+    const sf::Vector2f playerSize = {TILE_SIZE * 0.8f, TILE_SIZE * 0.95f};
+    float minX = std::min(view.getSize().x / 2.f, level.sizePixels.x / 2.f);
+    float maxX = std::max(level.sizePixels.x - view.getSize().x / 2.f, minX);
+    float centerX = minX, direction = 1.f;
+    float centerY = std::max(level.sizePixels.y - view.getSize().y / 2.f, level.sizePixels.y / 2.f);
+
+    BenchResult result;
+    result.levelWidth = level.size.x;
+    result.levelHeight = level.size.y;
+    result.zoom = zoom;
+    result.parallax = parallaxMode;
+    result.frames = frames;
+    std::vector<double> times;
+    times.reserve(frames);
+    for (int frame = -WARMUP_FRAMES; frame < frames; ++frame)
+    {
+        // Pan back and forth so chunks keep entering (and being built) and leaving the view.
+        centerX += direction * PAN_PIXELS_PER_FRAME;
+        if (centerX > maxX || centerX < minX)
+        {
+            direction = -direction;
+            centerX = std::clamp(centerX, minX, maxX);
+        }
+        view.setCenter({centerX, centerY});
+
+        auto start = std::chrono::steady_clock::now();
+        target.clear(sf::Color(100, 150, 255));
+        target.setView(view);
+        parallax.update(view, level); // No-ops without layers
+        parallax.drawBackground(target);
+        batch.begin();
+        tileRenderer.draw(batch, view, level);
+        drawPlayer(batch, atlas, view.getCenter(), playerSize);
+        batch.flush(target, atlas.getTexture());
+        parallax.drawForeground(target);
+        target.display();
+        glFinish(); // Wait for the frame to actually be rendered
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (frame < 0)
+            continue;
+        times.push_back(ms);
+        result.drawCalls += batch.getDrawCalls() + parallax.getDrawCalls(); // No parallax: 0
+        result.tilesDrawn += tileRenderer.lastTilesDrawn;
+        result.parallaxColumns += parallax.getColumnsRedrawn();
+    }
+
+    double total = 0.0;
+    for (double ms : times)
+        total += ms;
+    std::sort(times.begin(), times.end());
+    result.meanMs = total / times.size();
+    result.p50Ms = times[times.size() / 2];
+    result.p99Ms = times[std::min(times.size() - 1, times.size() * 99 / 100)];
+    result.maxMs = times.back();
+    result.drawCalls /= times.size();
+    result.tilesDrawn /= times.size();
+    result.parallaxColumns /= times.size();
+    return result;
+}
+
+// --- Main Function ---
+int main(int argc, char **argv)
+{
+    int frames = 300;
+    const char *outPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frames = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            outPath = argv[++i];
+        else
+        {
+            std::fprintf(stderr, "usage: render_bench [--frames N] [--out results.json]\n");
+            return 1;
+        }
+    }
+
+    const sf::Vector2u LEVEL_SIZES[] = {{256, 64}, {1024, 256}, {4096, 512}};
+    const float ZOOMS[] = {1.f, 2.f, 4.f, 8.f}; // 8x shows ~19k tiles at once
+
+    sf::RenderTexture target;
+    if (!target.resize({WINDOW_WIDTH, WINDOW_HEIGHT}))
+    {
+        std::fprintf(stderr, "Error creating a %ux%u render texture (no OpenGL context?)\n", WINDOW_WIDTH, WINDOW_HEIGHT);
+        return 1;
+    }
+    SpriteAtlas atlas;
+    if (!atlas.build(""))
+        return 1;
+    const char *glRenderer = reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+
+    std::vector<BenchResult> results;
+    auto run = [&](const Level &level, float zoom, ParallaxMode parallaxMode)
+    {
+        results.push_back(runConfig(target, atlas, level, zoom, parallaxMode, frames));
+        const BenchResult &r = results.back();
+        std::fprintf(stderr,
+                     "%5ux%-4u zoom %.0fx parallax %-8s: mean %.3f ms, p99 %.3f ms, %.0f tiles, %.1f columns, "
+                     "%.1f draw calls\n",
+                     r.levelWidth, r.levelHeight, r.zoom, getParallaxModeName(r.parallax), r.meanMs, r.p99Ms,
+                     r.tilesDrawn, r.parallaxColumns, r.drawCalls);
+    };
+    for (sf::Vector2u size : LEVEL_SIZES)
+    {
+        Level level = makeBenchLevel(size.x, size.y, 42);
+        for (float zoom : ZOOMS)
+            run(level, zoom, ParallaxMode::Cached);
+    }
+    // What the parallax layers cost, and what the column cache saves.
+    Level parallaxLevel = makeBenchLevel(1024, 256, 42);
+    run(parallaxLevel, 1.f, ParallaxMode::None);
+    run(parallaxLevel, 1.f, ParallaxMode::Uncached);
+
+    // --- Report (JSON) ---
+    FILE *out = outPath ? std::fopen(outPath, "w") : stdout;
+    if (!out)
+    {
+        std::fprintf(stderr, "Error creating %s\n", outPath);
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"benchmark\": \"render\",\n  \"gl_renderer\": \"%s\",\n  \"target\": [%u, %u],\n"
+                      "  \"frames_per_config\": %d,\n  \"results\": [\n",
+                 glRenderer ? glRenderer : "unknown", WINDOW_WIDTH, WINDOW_HEIGHT, frames);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult &r = results[i];
+        std::fprintf(out,
+                     "    {\"level\": [%u, %u], \"zoom\": %.1f, \"parallax\": \"%s\", \"mean_ms\": %.4f, "
+                     "\"p50_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f, \"draw_calls\": %.2f, "
+                     "\"tiles_drawn\": %.0f, \"parallax_columns\": %.2f}%s\n",
+                     r.levelWidth, r.levelHeight, r.zoom, getParallaxModeName(r.parallax), r.meanMs, r.p50Ms, r.p99Ms,
+                     r.maxMs, r.drawCalls, r.tilesDrawn, r.parallaxColumns, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+    if (out != stdout)
+        std::fclose(out);
+    return 0;
+}
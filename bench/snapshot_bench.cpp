@@ -0,0 +1,119 @@
+// --- Includes ---
+#include <chrono>   // For timing
+#include <cstdio>   // For std::printf
+#include <cstdlib>  // For std::exit
+#include <random>   // For reproducible tile edits and entity placement
+#include <vector>   // For the snapshot lists
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"     // TILE_SIZE, LEVEL_CHUNK_SIZE
+#include "gamefiles/Level.hpp"         // Level
+#include "gamefiles/LevelGenerator.hpp" // Generated levels
+#include "gamefiles/Simulation.hpp"    // The state being saved
+#include "gamefiles/WorldSnapshot.hpp" // Save states and the rewind buffer being measured
+
+// Cost of save states and rewind on large levels. The first table takes one snapshot per
+// tick for a second while a few tiles change every tick, once by copying the whole tile
+// grid and once with shared copy-on-write chunks, and reports the time per snapshot and
+// the tile memory the second's snapshots hold. The second table records a second of
+// rewind history with some of the entities moving and reports its memory, which should
+// follow the moving entities, not the total.
+
+// --- Helper Functions (Specific to this file) ---
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The standard generated stress-test level, 'side' x 'side' tiles.
+Level makeBenchLevel(unsigned int side)
+{
+    LevelGenParams params;
+    params.size = {side, side};
+    params.seed = 42;
+    Level level;
+    if (!generateLevel(params, level))
+        std::exit(1); // Never measure an empty level
+    return level;
+}
+
+// --- Main Function ---
+int main()
+{
+    const unsigned int SIDES[] = {256, 1024, 4096};
+    const int TICKS = 60;          // One second of snapshots
+    const int EDITS_PER_TICK = 4;  // Coin pickups and broken tiles per tick
+
+    std::printf("%11s | %14s %14s | %14s %14s\n", "level", "full copy ms", "full copy MB", "chunks ms", "chunks MB");
+    for (unsigned int side : SIDES)
+    {
+        Simulation sim(makeBenchLevel(side));
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> coordinate(0, (int)side - 2);
+
+        // Whole grid per snapshot.
+        std::vector<TileGrid> fullCopies;
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < TICKS; ++tick)
+        {
+            for (int edit = 0; edit < EDITS_PER_TICK; ++edit)
+                sim.level.setTile(coordinate(rng), coordinate(rng), TileType::Coin);
+            fullCopies.push_back(sim.level.tiles);
+        }
+        double fullMs = millisecondsSince(start) / TICKS;
+        double fullMb = (double)side * side * TICKS / (1024.0 * 1024.0);
+
+        // Shared chunks: one pointer per chunk, plus a copy of each chunk edited.
+        SnapshotStore store;
+        std::vector<WorldSnapshot> snapshots(TICKS);
+        store.capture(sim, snapshots[0]); // The first snapshot copies every chunk
+        std::size_t firstCopies = store.getChunkCopies();
+        start = std::chrono::steady_clock::now();
+        for (int tick = 1; tick < TICKS; ++tick)
+        {
+            for (int edit = 0; edit < EDITS_PER_TICK; ++edit)
+                sim.level.setTile(coordinate(rng), coordinate(rng), TileType::Coin);
+            store.capture(sim, snapshots[tick]);
+        }
+        double chunkMs = millisecondsSince(start) / (TICKS - 1);
+        std::size_t chunkBytes = store.getChunkCopies() * sizeof(TileChunk) +
+                                 snapshots.size() * snapshots[0].chunks.size() * sizeof(TileChunkRef);
+        std::printf("%5u x %4u | %14.3f %14.1f | %14.3f %14.1f  (%zu chunks, %zu copied after the first)\n", side,
+                    side, fullMs, fullMb, chunkMs, chunkBytes / (1024.0 * 1024.0), firstCopies,
+                    store.getChunkCopies() - firstCopies);
+    }
+
+    // --- Rewind Memory ---
+    const std::size_t ENTITY_COUNT = 10000;
+    const std::size_t MOVING[] = {0, 100, 1000, 10000};
+    std::printf("\n%9s %9s | %16s %12s\n", "entities", "moving", "rewind KB/s", "record us");
+    for (std::size_t moving : MOVING)
+    {
+        Simulation sim(makeBenchLevel(1024));
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(TILE_SIZE, 1000.f * TILE_SIZE);
+        for (std::size_t i = 0; i < ENTITY_COUNT; ++i)
+        {
+            std::size_t index = sim.entities.create(EntityKind::Pickup, {position(rng), position(rng)},
+                                                    {TILE_SIZE * 0.25f, TILE_SIZE * 0.25f}, ENTITY_ALIVE, 0.f);
+            if (i < moving)
+                sim.entities.setVelocity(index, {1.f, 0.f});
+        }
+        RewindBuffer rewind(REWIND_TICKS);
+        rewind.reset(sim);
+        std::vector<TileChange> noChanges;
+        double recordMs = 0.0;
+        for (int tick = 0; tick < TICKS; ++tick)
+        {
+            integrate(sim.entities); // Only the entities with a velocity move
+            sim.tick++;
+            auto start = std::chrono::steady_clock::now();
+            rewind.record(sim, noChanges);
+            recordMs += millisecondsSince(start);
+        }
+        std::printf("%9zu %9zu | %16.1f %12.1f\n", ENTITY_COUNT + 1, moving, rewind.getMemoryBytes() / 1024.0,
+                    recordMs * 1000.0 / TICKS);
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+// --- Includes ---
+#include <chrono>   // For timing
+#include <cmath>    // For std::sqrt, std::abs
+#include <cstdio>   // For std::printf
+#include <random>   // For reproducible entity placement
+#include <utility>  // For std::pair
+#include <vector>   // For entity/pair lists
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"   // TILE_SIZE
+#include "gamefiles/EntityStore.hpp" // Entities being hashed
+#include "gamefiles/SpatialHash.hpp" // The broad phase being measured
+
+// Per-tick cost of entity-vs-entity overlap detection from 100 to 100k entities:
+// spatial hash (rebuild, all overlapping pairs, and one 2-tile radius query per entity)
+// against brute-force all-pairs AABB tests. Entity density is kept constant (one entity
+// per 4 tiles on average), like a level that grows with its population.
+
+// --- Helper Functions (Specific to this file) ---
+
+// 'count' entities of player-like size scattered over a square world, moving randomly.
+EntityStore makeEntities(std::size_t count, std::mt19937 &rng)
+{
+    float worldSide = std::sqrt((float)count * 4.f) * TILE_SIZE;
+    std::uniform_real_distribution<float> coordinate(0.f, worldSide);
+    std::uniform_real_distribution<float> speed(-5.f, 5.f);
+    EntityStore entities;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t index = entities.create(EntityKind::Enemy, {coordinate(rng), coordinate(rng)},
+                                            {TILE_SIZE * 0.4f, TILE_SIZE * 0.475f}, ENTITY_ALIVE, 0.f);
+        entities.setVelocity(index, {speed(rng), speed(rng)});
+    }
+    return entities;
+}
+
+// All-pairs reference: O(n^2) box tests.
+std::size_t bruteForcePairs(const EntityStore &entities)
+{
+    std::size_t pairs = 0;
+    for (std::size_t a = 0; a < entities.size(); ++a)
+        for (std::size_t b = a + 1; b < entities.size(); ++b)
+            if (std::abs(entities.posX[a] - entities.posX[b]) < entities.halfW[a] + entities.halfW[b] &&
+                std::abs(entities.posY[a] - entities.posY[b]) < entities.halfH[a] + entities.halfH[b])
+                pairs++;
+    return pairs;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// --- Main Function ---
+int main()
+{
+    const std::size_t COUNTS[] = {100, 1000, 10000, 100000};
+    const int TICKS = 20;
+    const std::size_t BRUTE_FORCE_LIMIT = 10000; // 100k all-pairs would take minutes
+
+    std::mt19937 rng(42);
+    std::printf("%9s | %10s %10s %10s %8s | %14s %8s\n", "entities", "rebuild ms", "pairs ms", "radius ms", "pairs",
+                "brute force ms", "pairs");
+    for (std::size_t count : COUNTS)
+    {
+        EntityStore entities = makeEntities(count, rng);
+        SpatialHash hash;
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        std::vector<std::size_t> nearby;
+        double rebuildMs = 0.0;
+        double pairsMs = 0.0;
+        double radiusMs = 0.0;
+        std::size_t nearbyTotal = 0;
+
+        for (int tick = 0; tick < TICKS; ++tick)
+        {
+            integrate(entities); // Move everything, as a real tick would
+
+            auto start = std::chrono::steady_clock::now();
+            hash.rebuild(entities);
+            rebuildMs += millisecondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            pairs.clear();
+            hash.findOverlappingPairs(pairs);
+            pairsMs += millisecondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < entities.size(); ++i)
+            {
+                nearby.clear();
+                hash.queryRadius(entities.getPosition(i), TILE_SIZE * 2.f, nearby);
+                nearbyTotal += nearby.size();
+            }
+            radiusMs += millisecondsSince(start);
+        }
+
+        if (count <= BRUTE_FORCE_LIMIT)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::size_t brutePairs = bruteForcePairs(entities);
+            double bruteMs = millisecondsSince(start);
+            std::printf("%9zu | %10.3f %10.3f %10.3f %8zu | %14.3f %8zu\n", count, rebuildMs / TICKS, pairsMs / TICKS,
+                        radiusMs / TICKS, pairs.size(), bruteMs, brutePairs);
+        }
+        else
+        {
+            std::printf("%9zu | %10.3f %10.3f %10.3f %8zu | %14s %8s\n", count, rebuildMs / TICKS, pairsMs / TICKS,
+                        radiusMs / TICKS, pairs.size(), "skipped", "-");
+        }
+        if (nearbyTotal == 0)
+            std::printf("(no radius hits)\n"); // Uses the result so the queries can't be optimized out
+    }
+    return 0;
+}
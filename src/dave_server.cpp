@@ -0,0 +1,273 @@
+// --- Includes ---
+#include <algorithm>  // For std::sort
+#include <chrono>     // For pacing ticks
+#include <cstdint>    // For std::uint32_t
+#include <cstdio>     // For std::printf
+#include <cstdlib>    // For std::atoi, std::atof
+#include <cstring>    // For std::strcmp
+#include <iostream>   // For std::cout, std::cerr
+#include <memory>     // For the bot clients
+#include <random>     // For bot input
+#include <string>     // For std::string
+#include <thread>     // For std::this_thread::sleep_until
+#include <utility>    // For std::move
+#include <vector>     // For the bot and timing lists
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp"  // SIM_TICK_SECONDS
+#include "gamefiles/GameClient.hpp" // Bot clients for --bench
+#include "gamefiles/GameServer.hpp" // The server itself
+#include "gamefiles/LevelFile.hpp"  // Level loading (.txt, .csv, .dlvl)
+#include "gamefiles/LevelGenerator.hpp" // @gen: levels
+
+// Headless multiplayer server: runs rooms of players on one UDP port at the fixed tick
+// rate until killed. Every room plays its own copy of the level.
+//
+//   dave_server [--port P] [--threads N] [--max-rooms M] [--no-delta] [level]
+//   dave_server --bench [--rooms R] [--clients C] [--ticks T] [--loss F] [--threads N] [level]
+//
+// --bench starts a server on a free loopback port and R x C bot clients (C per room),
+// runs them unpaced for T ticks, once with delta compression and once sending whole
+// states, and prints the bandwidth per client (at 60 ticks per second), the server's cost
+// per room tick and how far client prediction had to be corrected. --loss drops that
+// fraction of the packets each bot sends and receives. The level defaults to @simple, the built-in
+// createSimpleLevel() map; @gen:<width>x<height>[:<seed>] generates one. --max-rooms caps the
+// rooms the server opens (default NET_DEFAULT_MAX_ROOMS); joins for further rooms are refused.
+
+// --- Helper Types (Specific to this file) ---
+
+// A GameClient driven by random input: runs one way for a while, sometimes stands, and
+// jumps now and then.
+struct BotClient {
+    GameClient client;
+    std::mt19937 random;
+    int direction = 0;  // -1 left, 0 none, 1 right
+    int ticksLeft = 0;  // Until the direction changes
+
+    BotClient(const Level &level, std::uint32_t seed) : client(level), random(seed) {}
+
+    InputState nextInput()
+    {
+        if (ticksLeft-- <= 0)
+        {
+            direction = std::uniform_int_distribution<int>(-1, 1)(random);
+            ticksLeft = std::uniform_int_distribution<int>(30, 120)(random);
+        }
+        InputState input;
+        input.left = direction < 0;
+        input.right = direction > 0;
+        input.jump = std::uniform_int_distribution<int>(0, 39)(random) == 0;
+        return input;
+    }
+};
+
+// Totals of one benchmark run.
+struct BenchResult {
+    double downBytesPerSecond = 0.0; // Per client, server to client
+    double upBytesPerSecond = 0.0;   // Per client, client to server
+    double roomMicrosMean = 0.0;     // Server cost of one room tick
+    double roomMicrosP99 = 0.0;
+    double tickMillisMean = 0.0;     // Whole server tick (all rooms, receiving and sending)
+    double correctionMean = 0.0;     // Pixels reconciliation moved a bot
+    double correctionMax = 0.0;
+    double statesReceived = 0.0;     // Fraction of ticks a bot got a usable state
+};
+
+// --- Helper Functions (Specific to this file) ---
+
+void printUsage()
+{
+    std::cerr << "usage: dave_server [--port P] [--threads N] [--max-rooms M] [--no-delta] [level]\n"
+              << "       dave_server --bench [--rooms R] [--clients C] [--ticks T] [--loss F] [--threads N] [level]\n"
+              << "  [level]  .dlvl, .csv or ASCII map file, @simple (default) for the built-in level,\n"
+              << "           or @gen:<width>x<height>[:<seed>] for a generated one\n";
+}
+
+// Runs 'rooms' x 'clientsPerRoom' bots against a loopback server for 'ticks' ticks.
+bool runBench(const Level &level, int rooms, int clientsPerRoom, int ticks, float loss, unsigned int threadCount,
+              bool deltaCompression, BenchResult &result)
+{
+    GameServer server(level, threadCount);
+    if (!server.start(0))
+        return false;
+    server.setDeltaCompression(deltaCompression);
+    server.setMaxRooms(rooms);
+
+    std::vector<std::unique_ptr<BotClient>> bots;
+    for (int i = 0; i < rooms * clientsPerRoom; ++i)
+    {
+        bots.push_back(std::make_unique<BotClient>(level, (std::uint32_t)i + 1));
+        if (!bots.back()->client.connect(sf::IpAddress::LocalHost, server.getPort(), (std::uint32_t)(i / clientsPerRoom)))
+            return false;
+        bots.back()->client.setSimulatedLoss(loss, (std::uint32_t)i + 1);
+    }
+
+    // One tick: every bot sends its input, then the server steps and answers. The server
+    // reads its socket every 64 bots, as a real one would between ticks, so the socket's
+    // buffer never overflows.
+    auto runTick = [&] {
+        for (std::size_t i = 0; i < bots.size(); ++i)
+        {
+            bots[i]->client.update(bots[i]->nextInput());
+            if (i % 64 == 63)
+                server.receivePackets();
+        }
+        server.tick();
+    };
+
+    // --- Join ---
+    for (int tick = 0; tick < 600 && server.getClientCount() < bots.size(); ++tick)
+        runTick();
+    if (server.getClientCount() < bots.size())
+    {
+        std::cerr << "Only " << server.getClientCount() << " of " << bots.size() << " bots could join" << std::endl;
+        return false;
+    }
+
+    // --- Measure ---
+    std::uint64_t downStart = 0, upStart = 0, statesStart = 0;
+    for (const auto &bot : bots)
+    {
+        downStart += bot->client.getBytesReceived();
+        upStart += bot->client.getBytesSent();
+        statesStart += bot->client.getStatesReceived();
+    }
+    std::vector<float> roomMicros;
+    double tickMillis = 0.0;
+    for (int tick = 0; tick < ticks; ++tick)
+    {
+        auto start = std::chrono::steady_clock::now();
+        runTick();
+        tickMillis += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        const std::vector<float> &micros = server.getRoomStepMicros();
+        roomMicros.insert(roomMicros.end(), micros.begin(), micros.end());
+    }
+
+    std::uint64_t down = 0, up = 0, states = 0, reconciliations = 0;
+    double correctionTotal = 0.0;
+    result.correctionMax = 0.0;
+    for (const auto &bot : bots)
+    {
+        down += bot->client.getBytesReceived();
+        up += bot->client.getBytesSent();
+        states += bot->client.getStatesReceived();
+        reconciliations += bot->client.getReconciliations();
+        correctionTotal += bot->client.getCorrectionTotal();
+        result.correctionMax = std::max(result.correctionMax, (double)bot->client.getCorrectionMax());
+    }
+    double clientTicks = (double)bots.size() * ticks;
+    result.downBytesPerSecond = (down - downStart) / clientTicks / SIM_TICK_SECONDS;
+    result.upBytesPerSecond = (up - upStart) / clientTicks / SIM_TICK_SECONDS;
+    result.statesReceived = (states - statesStart) / clientTicks;
+    result.correctionMean = reconciliations > 0 ? correctionTotal / reconciliations : 0.0;
+    std::sort(roomMicros.begin(), roomMicros.end());
+    double microsTotal = 0.0;
+    for (float micros : roomMicros)
+        microsTotal += micros;
+    result.roomMicrosMean = roomMicros.empty() ? 0.0 : microsTotal / roomMicros.size();
+    result.roomMicrosP99 = roomMicros.empty() ? 0.0 : roomMicros[roomMicros.size() * 99 / 100];
+    result.tickMillisMean = tickMillis / ticks;
+    return true;
+}
+
+// --- Main Function ---
+int main(int argc, char **argv)
+{
+    // --- Parse Arguments ---
+    bool bench = false;
+    bool deltaCompression = true;
+    unsigned short port = NET_DEFAULT_PORT;
+    unsigned int threadCount = 0; // 0 = one per hardware thread
+    int rooms = 64;
+    int maxRooms = (int)NET_DEFAULT_MAX_ROOMS;
+    int clientsPerRoom = 4;
+    int ticks = 600;
+    float loss = 0.f;
+    std::string levelPath = "@simple";
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--bench") == 0)
+            bench = true;
+        else if (std::strcmp(argv[i], "--no-delta") == 0)
+            deltaCompression = false;
+        else if (std::strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+            port = (unsigned short)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threadCount = (unsigned int)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--max-rooms") == 0 && i + 1 < argc)
+            maxRooms = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--rooms") == 0 && i + 1 < argc)
+            rooms = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--clients") == 0 && i + 1 < argc)
+            clientsPerRoom = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+            ticks = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--loss") == 0 && i + 1 < argc)
+            loss = (float)std::atof(argv[++i]);
+        else if (argv[i][0] != '-')
+            levelPath = argv[i];
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    if (rooms < 1 || maxRooms < 1 || clientsPerRoom < 1 || clientsPerRoom > (int)NET_MAX_ROOM_PLAYERS || ticks < 1)
+    {
+        printUsage();
+        return 1;
+    }
+
+    Level level;
+    if (levelPath == "@simple")
+        level = createSimpleLevel();
+    else if (isGeneratedLevelName(levelPath))
+    {
+        if (!generateLevelFromName(levelPath, level))
+            return 1;
+    }
+    else if (!loadLevel(levelPath, level))
+        return 1;
+
+    // --- Benchmark ---
+    if (bench)
+    {
+        std::printf("%d rooms x %d clients, %d ticks, %.0f%% loss\n", rooms, clientsPerRoom, ticks, loss * 100.f);
+        std::printf("%8s | %12s %12s | %12s %12s %12s | %10s %10s %8s\n", "states", "down B/s", "up B/s",
+                    "room us", "room p99 us", "tick ms", "corr px", "max px", "received");
+        for (bool delta : {true, false})
+        {
+            BenchResult result;
+            if (!runBench(level, rooms, clientsPerRoom, ticks, loss, threadCount, delta, result))
+                return 1;
+            std::printf("%8s | %12.0f %12.0f | %12.2f %12.2f %12.3f | %10.4f %10.2f %8.3f\n", delta ? "delta" : "whole",
+                        result.downBytesPerSecond, result.upBytesPerSecond, result.roomMicrosMean, result.roomMicrosP99,
+                        result.tickMillisMean, result.correctionMean, result.correctionMax, result.statesReceived);
+        }
+        return 0;
+    }
+
+    // --- Serve ---
+    GameServer server(std::move(level), threadCount);
+    if (!server.start(port))
+        return 1;
+    server.setDeltaCompression(deltaCompression);
+    server.setMaxRooms(maxRooms);
+    std::cout << "Serving " << levelPath << " on UDP port " << server.getPort() << std::endl;
+
+    auto tickDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(SIM_TICK_SECONDS));
+    auto nextTick = std::chrono::steady_clock::now();
+    for (std::uint64_t tick = 1;; ++tick)
+    {
+        server.tick();
+        if (tick % 3600 == 0) // Once a minute
+        {
+            std::cout << server.getClientCount() << " clients in " << server.getRoomCount() << " rooms, "
+                      << server.getBytesSent() << " bytes sent, " << server.getBytesReceived() << " received"
+                      << std::endl;
+        }
+        nextTick += tickDuration;
+        std::this_thread::sleep_until(nextTick);
+    }
+}
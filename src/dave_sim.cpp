@@ -0,0 +1,166 @@
+// --- Includes ---
+#include <chrono>     // For timing the whole batch
+#include <cstdint>    // For std::uint64_t
+#include <cstdlib>    // For std::atoi
+#include <cstring>    // For std::strcmp
+#include <iostream>   // For std::cout, std::cerr
+#include <string>     // For std::string
+#include <vector>     // For the level/script/result lists
+
+// Include our custom headers
+#include "gamefiles/InputLog.hpp"    // Recorded (.dinp) input
+#include "gamefiles/InputScript.hpp" // Scripted input and playback
+#include "gamefiles/LevelFile.hpp"   // Level loading (.txt, .csv, .dlvl)
+#include "gamefiles/LevelGenerator.hpp" // @gen: levels
+#include "gamefiles/Simulation.hpp"  // Headless game state
+#include "gamefiles/ThreadPool.hpp"  // Work-stealing worker pool
+
+// Headless rollout runner: plays every input script on every level, with no window,
+// and prints one CSV line per run. Used to validate levels in bulk.
+//
+//   dave_sim [--threads N] --levels <level>... --scripts <script>...
+//
+// A level argument of '@simple' uses the built-in createSimpleLevel() map, and
+// '@gen:<width>x<height>[:<seed>]' a generated one (see LevelGenerator.hpp).
+// A script ending in .dinp is a recording made with 'main --record'. It is replayed as
+// fast as possible and, on the level it was recorded on, its final state must match the
+// recording bit for bit; any mismatch is reported and the exit code is 2.
+
+// --- Helper Types (Specific to this file) ---
+
+// Outcome of one level x script rollout.
+struct RolloutResult {
+    int score = 0;           // Final score
+    int deaths = 0;          // Times the player fell out of the level
+    std::uint64_t ticks = 0; // Simulation ticks run
+    bool checked = false;    // Was the final state compared against a recording?
+    bool matched = false;    // ... and was it identical?
+};
+
+// --- Helper Functions (Specific to this file) ---
+
+void printUsage()
+{
+    std::cerr << "usage: dave_sim [--threads N] --levels <level>... --scripts <script>...\n"
+              << "  <level>   .dlvl, .csv or ASCII map file, @simple for the built-in level,\n"
+              << "            or @gen:<width>x<height>[:<seed>] for a generated one\n"
+              << "  <script>  text input script ('<ticks> <keys>' per line), or a .dinp recording\n";
+}
+
+// --- Main Function ---
+int main(int argc, char **argv)
+{
+    // --- Parse Arguments ---
+    unsigned int threadCount = 0; // 0 = one per hardware thread
+    std::vector<std::string> levelPaths;
+    std::vector<std::string> scriptPaths;
+    std::vector<std::string> *currentList = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threadCount = (unsigned int)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--levels") == 0)
+            currentList = &levelPaths;
+        else if (std::strcmp(argv[i], "--scripts") == 0)
+            currentList = &scriptPaths;
+        else if (currentList && argv[i][0] != '-')
+            currentList->push_back(argv[i]);
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    if (levelPaths.empty() || scriptPaths.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    // --- Load Inputs (once, shared read-only by every rollout) ---
+    std::vector<Level> levels(levelPaths.size());
+    for (std::size_t i = 0; i < levelPaths.size(); ++i)
+    {
+        if (levelPaths[i] == "@simple")
+            levels[i] = createSimpleLevel();
+        else if (isGeneratedLevelName(levelPaths[i]))
+        {
+            if (!generateLevelFromName(levelPaths[i], levels[i]))
+                return 1;
+        }
+        else if (!loadLevel(levelPaths[i], levels[i]))
+            return 1;
+    }
+    std::vector<InputScript> scripts(scriptPaths.size());
+    std::vector<InputLog> recordings(scriptPaths.size()); // Only filled for .dinp scripts
+    for (std::size_t i = 0; i < scriptPaths.size(); ++i)
+    {
+        const std::string &path = scriptPaths[i];
+        if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".dinp") == 0)
+        {
+            if (!loadInputLog(path, recordings[i]))
+                return 1;
+            scripts[i] = toInputScript(recordings[i], path);
+        }
+        else if (!loadInputScript(path, scripts[i]))
+            return 1;
+    }
+    std::vector<std::uint64_t> levelChecksums(levels.size());
+    for (std::size_t i = 0; i < levels.size(); ++i)
+        levelChecksums[i] = computeLevelChecksum(levels[i]);
+
+    // --- Run All Rollouts ---
+    // Each task writes only its own result slot, so no locking is needed.
+    std::vector<RolloutResult> results(levels.size() * scripts.size());
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(threadCount);
+        threadCount = pool.getThreadCount();
+        for (std::size_t l = 0; l < levels.size(); ++l)
+        {
+            for (std::size_t s = 0; s < scripts.size(); ++s)
+            {
+                pool.submit([&, l, s] {
+                    Simulation sim(levels[l]); // Private copy: coins get collected
+                    RolloutResult &result = results[l * scripts.size() + s];
+                    result.deaths = runInputScript(sim, scripts[s]);
+                    result.score = sim.player.score;
+                    result.ticks = sim.tick;
+                    const InputLog &recording = recordings[s];
+                    if (recording.hasFingerprint && recording.levelChecksum == levelChecksums[l])
+                    {
+                        result.checked = true;
+                        result.matched = captureFingerprint(sim) == recording.fingerprint;
+                    }
+                });
+            }
+        }
+        pool.waitIdle();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // --- Report ---
+    std::uint64_t totalTicks = 0;
+    int mismatches = 0;
+    std::cout << "level,script,score,deaths,ticks\n";
+    for (std::size_t l = 0; l < levels.size(); ++l)
+    {
+        for (std::size_t s = 0; s < scripts.size(); ++s)
+        {
+            const RolloutResult &result = results[l * scripts.size() + s];
+            std::cout << levelPaths[l] << ',' << scripts[s].name << ',' << result.score << ','
+                      << result.deaths << ',' << result.ticks << '\n';
+            totalTicks += result.ticks;
+            if (result.checked && !result.matched)
+            {
+                std::cerr << "Replay mismatch: " << scripts[s].name << " on " << levelPaths[l]
+                          << " does not reproduce the recorded final state" << std::endl;
+                mismatches++;
+            }
+        }
+    }
+    std::cerr << results.size() << " rollouts, " << totalTicks << " ticks on " << threadCount
+              << " threads in " << seconds << " s (" << (seconds > 0 ? totalTicks / seconds : 0.0)
+              << " ticks/s)" << std::endl;
+    return mismatches > 0 ? 2 : 0;
+}
@@ -0,0 +1,239 @@
+#include "AssetManager.hpp" // Include the header definition for AssetManager
+#include "LevelFile.hpp"    // loadLevel
+#include <filesystem>       // For checking that files exist, normalizing paths
+#include <fstream>          // For reading font files
+#include <iostream>         // For std::cerr
+#include <utility>          // For std::move
+
+namespace {
+
+// --- Worker Halves ---
+// Read and decode a file into what the main thread needs to finish the asset. They never
+// touch an AssetEntry or the GPU.
+
+// What the worker hands over for each asset type.
+template <class T> struct Decoded;
+template <> struct Decoded<sf::Font> { using Type = std::vector<std::uint8_t>; }; // The file
+template <> struct Decoded<sf::Image> { using Type = sf::Image; };
+template <> struct Decoded<sf::Texture> { using Type = sf::Image; };             // Uploaded later
+template <> struct Decoded<Level> { using Type = Level; };
+
+bool exists(const std::string& path) {
+    std::error_code error;
+    return std::filesystem::exists(path, error);
+}
+
+AssetState decodeAsset(const std::string& path, std::vector<std::uint8_t>& bytes) {
+    if (!exists(path)) return AssetState::Missing;
+    std::ifstream file(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (!file && !file.eof()) {
+        std::cerr << "Error reading " << path << std::endl;
+        return AssetState::Failed;
+    }
+    return AssetState::Ready;
+}
+
+AssetState decodeAsset(const std::string& path, sf::Image& image) {
+    if (!exists(path)) return AssetState::Missing;
+    return image.loadFromFile(path) ? AssetState::Ready : AssetState::Failed; // SFML prints why
+}
+
+AssetState decodeAsset(const std::string& path, Level& level) {
+    if (!exists(path)) return AssetState::Missing;
+    return loadLevel(path, level) ? AssetState::Ready : AssetState::Failed; // loadLevel prints why
+}
+
+// --- Main-Thread Halves ---
+// Turn the decoded data into the asset. Return false (after printing why) if they cannot.
+
+bool install(AssetEntry<sf::Font>& entry, std::vector<std::uint8_t>& bytes) {
+    // The font reads glyphs from the bytes for as long as it is open, so they move into
+    // the entry together; the old bytes go once the old font is gone.
+    sf::Font font;
+    if (!font.openFromMemory(bytes.data(), bytes.size())) {
+        std::cerr << "Error loading font " << entry.path << std::endl;
+        return false;
+    }
+    entry.value = std::move(font);
+    entry.bytes.swap(bytes);
+    return true;
+}
+
+bool install(AssetEntry<sf::Image>& entry, sf::Image& image) {
+    entry.value = std::move(image);
+    return true;
+}
+
+bool install(AssetEntry<sf::Texture>& entry, sf::Image& image) {
+    sf::Texture texture;
+    if (!texture.loadFromImage(image)) {
+        std::cerr << "Error creating a texture for " << entry.path << std::endl;
+        return false;
+    }
+    entry.value = std::move(texture);
+    return true;
+}
+
+bool install(AssetEntry<Level>& entry, Level& level) {
+    entry.value = std::move(level);
+    return true;
+}
+
+// Applies a finished (re)load to its entry. A failed reload keeps the version in use.
+template <class T, class D>
+void finishLoad(AssetEntry<T>& entry, D& decoded, AssetState state) {
+    bool reload = entry.reloadQueued;
+    entry.reloadQueued = false;
+    if (state == AssetState::Ready && install(entry, decoded)) {
+        entry.state = AssetState::Ready;
+        entry.version++;
+        if (reload) {
+            std::cout << "Reloaded " << entry.path << '\n';
+        }
+        return;
+    }
+    if (entry.state == AssetState::Ready) {
+        std::cerr << "Warning: could not reload " << entry.path << ", keeping the old version" << std::endl;
+        return;
+    }
+    entry.state = state == AssetState::Ready ? AssetState::Failed : state;
+}
+
+// The key an asset is deduplicated by.
+std::string normalizePath(const std::string& path) {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Constructor
+AssetManager::AssetManager(unsigned int threadCount)
+    : pool(threadCount)
+{
+}
+
+// Destructor
+AssetManager::~AssetManager() {
+    pool.waitIdle(); // Workers push into 'finished'; let them finish before it goes
+}
+
+AssetHandle<sf::Font> AssetManager::loadFont(const std::string& path) {
+    return request(fonts, path);
+}
+
+AssetHandle<sf::Image> AssetManager::loadImage(const std::string& path) {
+    return request(images, path);
+}
+
+AssetHandle<sf::Texture> AssetManager::loadTexture(const std::string& path) {
+    return request(textures, path);
+}
+
+AssetHandle<Level> AssetManager::loadLevel(const std::string& path) {
+    return request(levels, path);
+}
+
+// Turns hot reload on or off.
+void AssetManager::setHotReload(bool enabled) {
+    if (enabled && !hotReload) {
+        auto watchAll = [this](const auto& table) {
+            for (const auto& slot : table) {
+                if (auto entry = slot.second.lock()) watcher.watch(entry->path);
+            }
+        };
+        watchAll(fonts);
+        watchAll(images);
+        watchAll(textures);
+        watchAll(levels);
+    }
+    hotReload = enabled;
+}
+
+// Finishes completed loads and starts reloading changed files.
+void AssetManager::update() {
+    {
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        finishing.swap(finished);
+    }
+    for (std::function<void()>& finish : finishing) {
+        finish();
+    }
+    finishing.clear();
+
+    if (hotReload) {
+        changedFiles.clear();
+        watcher.poll(changedFiles);
+        for (const std::string& path : changedFiles) {
+            reload(fonts, path);
+            reload(images, path);
+            reload(textures, path);
+            reload(levels, path);
+        }
+    }
+}
+
+// Blocks until at least one load has finished, then finishes it.
+void AssetManager::waitForLoads() {
+    {
+        std::unique_lock<std::mutex> lock(finishedMutex);
+        finishedSignal.wait(lock, [this] { return !finished.empty(); });
+    }
+    update();
+}
+
+// Returns the asset of 'path', starting to load it if there is none.
+template <class T>
+AssetHandle<T> AssetManager::request(AssetTable<T>& table, const std::string& path) {
+    std::weak_ptr<AssetEntry<T>>& slot = table[normalizePath(path)];
+    AssetHandle<T> handle;
+    handle.entry = slot.lock();
+    if (!handle.entry) {
+        handle.entry = std::make_shared<AssetEntry<T>>();
+        handle.entry->path = path;
+        slot = handle.entry;
+        startLoad(handle.entry);
+        if (hotReload) {
+            watcher.watch(path);
+        }
+    }
+    return handle;
+}
+
+// Reads and decodes the file on a worker.
+template <class T>
+void AssetManager::startLoad(const std::shared_ptr<AssetEntry<T>>& entry) {
+    pending++;
+    std::weak_ptr<AssetEntry<T>> weakEntry = entry;
+    std::string path = entry->path;
+    pool.submit([this, weakEntry, path] {
+        auto decoded = std::make_shared<typename Decoded<T>::Type>();
+        AssetState state = decodeAsset(path, *decoded);
+        // The rest runs in update(), on the main thread; if every handle is gone by
+        // then, the result is simply dropped.
+        std::function<void()> finish = [this, weakEntry, decoded, state] {
+            pending--;
+            if (std::shared_ptr<AssetEntry<T>> entry = weakEntry.lock()) {
+                finishLoad(*entry, *decoded, state);
+            }
+        };
+        {
+            std::lock_guard<std::mutex> lock(finishedMutex);
+            finished.push_back(std::move(finish));
+        }
+        finishedSignal.notify_all();
+    });
+}
+
+// Starts reloading the asset of 'path', if it is loaded.
+template <class T>
+void AssetManager::reload(AssetTable<T>& table, const std::string& path) {
+    auto slot = table.find(normalizePath(path));
+    if (slot == table.end()) return;
+    std::shared_ptr<AssetEntry<T>> entry = slot->second.lock();
+    if (!entry || entry->reloadQueued) return;
+    entry->reloadQueued = true;
+    startLoad(entry);
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <SFML/Graphics/Font.hpp>    // Font assets
+#include <SFML/Graphics/Image.hpp>   // Image assets (pixels in memory)
+#include <SFML/Graphics/Texture.hpp> // Texture assets (pixels on the GPU)
+#include "FileWatcher.hpp"           // Changed files, for hot reload
+#include "Level.hpp"                 // Level assets
+#include "ThreadPool.hpp"            // Files are read and decoded on workers
+
+// --- Asset Handles ---
+enum class AssetState : std::uint8_t {
+    Loading, // Not loaded yet
+    Ready,   // get() is valid
+    Missing, // The file does not exist (it is loaded if it appears later)
+    Failed,  // The file could not be read or decoded (the problem went to std::cerr)
+};
+
+// One loaded file, shared by every handle to it. Only touched on the main thread.
+template <class T>
+struct AssetEntry {
+    std::string path;
+    AssetState state = AssetState::Loading;
+    unsigned int version = 0;         // Bumped whenever 'value' is replaced
+    bool reloadQueued = false;        // A reload is running on a worker
+    T value{};
+    std::vector<std::uint8_t> bytes;  // The file, for assets read lazily from memory (fonts)
+};
+
+// Reference-counted handle to an asset of an AssetManager. Copies share the asset; it is
+// freed once the last handle is gone. Like the manager, only use it on the main thread.
+template <class T>
+class AssetHandle {
+public:
+    AssetHandle() = default;
+
+    AssetState getState() const { return entry ? entry->state : AssetState::Failed; }
+    bool isReady() const { return entry && entry->state == AssetState::Ready; }
+    bool isLoading() const { return entry && entry->state == AssetState::Loading; }
+    // The asset. Only valid while isReady(). Hot reload replaces it in place, so
+    // references stay valid, but things built from it (e.g. layouts) must be rebuilt when
+    // getVersion() changes.
+    const T& get() const { return entry->value; }
+    // Changes every time the asset is (re)loaded; 0 until it first is.
+    unsigned int getVersion() const { return entry ? entry->version : 0; }
+    const std::string& getPath() const { return entry->path; }
+
+private:
+    friend class AssetManager;
+    std::shared_ptr<AssetEntry<T>> entry;
+};
+
+// --- Asset Manager ---
+// Loads fonts, images, textures and levels on a thread pool. load*() returns at once with
+// a handle that becomes ready in a later update(), so startup can request every asset
+// and open the window while they load in parallel; only what the first frame cannot do
+// without needs to be wait()ed for. Asking for a file that is already loaded (or
+// loading) returns the same asset. With hot reload on, files changed on disk are loaded
+// again on a worker and replace the old version in update(); until then the old one
+// stays in use, so nothing ever waits on the disk mid-game.
+//
+// Workers only read and decode files. Everything that needs the main thread (uploading
+// textures, opening fonts, replacing assets) happens in update(), so the manager and
+// its handles must only be used from the thread that calls it.
+class AssetManager {
+public:
+    // Starts 'threadCount' loader threads (0 means one per hardware thread).
+    explicit AssetManager(unsigned int threadCount = 0);
+    // Waits for running loads to finish; their results are dropped.
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    // --- Loading ---
+    AssetHandle<sf::Font> loadFont(const std::string& path);
+    AssetHandle<sf::Image> loadImage(const std::string& path);
+    // Decoded on a worker, uploaded to the GPU in update().
+    AssetHandle<sf::Texture> loadTexture(const std::string& path);
+    // Any format loadLevel() reads.
+    AssetHandle<Level> loadLevel(const std::string& path);
+
+    // Watches every loaded file for changes from now on (off by default).
+    void setHotReload(bool enabled);
+
+    // --- Per Frame ---
+    // Finishes the loads completed since the last call and starts reloading the files
+    // that changed. Never blocks.
+    void update();
+    // Blocks (calling update()) until 'handle' has finished loading. Returns isReady().
+    template <class T>
+    bool wait(const AssetHandle<T>& handle) {
+        while (handle.isLoading()) {
+            waitForLoads();
+        }
+        return handle.isReady();
+    }
+
+    // Loads running or finished but not yet picked up by update().
+    std::size_t getPendingCount() const { return pending; }
+
+private:
+    template <class T>
+    using AssetTable = std::unordered_map<std::string, std::weak_ptr<AssetEntry<T>>>; // By path
+
+    // Returns the asset of 'path' in 'table', starting to load it if there is none.
+    template <class T>
+    AssetHandle<T> request(AssetTable<T>& table, const std::string& path);
+    // Reads and decodes 'entry''s file on a worker; update() then finishes it.
+    template <class T>
+    void startLoad(const std::shared_ptr<AssetEntry<T>>& entry);
+    // Starts reloading the asset of 'path' in 'table', if there is one.
+    template <class T>
+    void reload(AssetTable<T>& table, const std::string& path);
+    // Blocks until at least one load has finished, then calls update().
+    void waitForLoads();
+
+    AssetTable<sf::Font> fonts;
+    AssetTable<sf::Image> images;
+    AssetTable<sf::Texture> textures;
+    AssetTable<Level> levels;
+
+    bool hotReload = false;
+    FileWatcher watcher;
+    std::vector<std::string> changedFiles;  // Reused by update()
+    std::size_t pending = 0;                // Loads started but not finished in update()
+
+    std::mutex finishedMutex;                        // Guards 'finished'
+    std::condition_variable finishedSignal;          // Signalled when a load finishes
+    std::vector<std::function<void()>> finished;     // Main-thread halves of finished loads
+    std::vector<std::function<void()>> finishing;    // Swapped with 'finished' by update()
+    ThreadPool pool;                                 // Last, so it stops before the rest goes
+};
@@ -0,0 +1,251 @@
+#include "AudioMixer.hpp" // Include the header definition for AudioMixer
+#include <algorithm>      // For std::clamp, std::min
+#include <chrono>         // For the null output's pace
+#include <cmath>          // For std::sin, std::pow
+#include <initializer_list> // For the notes of a sound
+
+namespace {
+
+const float PI = 3.14159265f;
+
+// Indexed by SoundId. Hurting and falling matter most; coins are plentiful and least.
+const SoundDesc SOUND_DESCS[(std::size_t)SoundId::Count] = {
+    {"coin", 1, 4, 0.45f},
+    {"hurt", 3, 2, 0.8f},
+    {"fall", 3, 1, 0.8f},
+    {"save", 2, 1, 0.6f},
+    {"fail", 2, 1, 0.6f},
+};
+
+// --- Synthesis ---
+// Each sound is a few notes of a simple waveform under a decaying envelope.
+
+enum class Wave { Sine, Square, Triangle, Noise };
+
+// One note: 'seconds' long, sliding from 'startHz' to 'endHz', fading out with 'decay'
+// (the fraction of the level left at the end).
+struct Note {
+    Wave wave;
+    float startHz, endHz;
+    float seconds;
+    float decay;
+};
+
+void appendNote(std::vector<std::int16_t>& samples, const Note& note, std::uint32_t& noise) {
+    const std::size_t count = (std::size_t)(note.seconds * AUDIO_SAMPLE_RATE);
+    const std::size_t attack = std::min<std::size_t>(count, AUDIO_SAMPLE_RATE / 500); // 2 ms, avoids a click
+    float phase = 0.f;
+    for (std::size_t i = 0; i < count; ++i) {
+        float t = (float)i / count;
+        float hz = note.startHz + (note.endHz - note.startHz) * t;
+        phase += hz / AUDIO_SAMPLE_RATE;
+        phase -= (float)(int)phase;
+        float value = 0.f;
+        switch (note.wave) {
+            case Wave::Sine: value = std::sin(2.f * PI * phase); break;
+            case Wave::Square: value = phase < 0.5f ? 0.6f : -0.6f; break;
+            case Wave::Triangle: value = phase < 0.5f ? 4.f * phase - 1.f : 3.f - 4.f * phase; break;
+            case Wave::Noise:
+                noise = noise * 1664525u + 1013904223u;
+                value = (float)(noise >> 16) / 32768.f - 1.f;
+                break;
+        }
+        float envelope = std::pow(note.decay, t) * (i < attack ? (float)i / attack : 1.f);
+        samples.push_back((std::int16_t)(value * envelope * 32767.f));
+    }
+}
+
+void synthesize(std::vector<std::int16_t>& samples, std::initializer_list<Note> notes) {
+    std::uint32_t noise = 12345;
+    samples.clear();
+    for (const Note& note : notes) {
+        appendNote(samples, note, noise);
+    }
+}
+
+} // namespace
+
+// --- Non-Member Function Implementations ---
+
+const SoundDesc& getSoundDesc(SoundId sound) {
+    return SOUND_DESCS[(std::size_t)sound];
+}
+
+bool getEventSound(const GameEvent& event, SoundId& sound) {
+    switch (event.type) {
+        case GameEventType::CoinCollected: sound = SoundId::Coin; return true;
+        case GameEventType::PlayerFellOut: sound = SoundId::Fall; return true;
+        case GameEventType::PlayerHitEnemy:
+        case GameEventType::PlayerHitHazard: sound = SoundId::Hurt; return true;
+        case GameEventType::QuickSaved:
+        case GameEventType::QuickLoaded: sound = event.value < 0 ? SoundId::Fail : SoundId::Save; return true;
+    }
+    return false;
+}
+
+void synthesizeSoundBank(SoundBank& bank) {
+    auto& samples = bank.samples;
+    synthesize(samples[(std::size_t)SoundId::Coin], {{Wave::Square, 988.f, 988.f, 0.06f, 0.8f},
+                                                     {Wave::Square, 1319.f, 1319.f, 0.2f, 0.05f}});
+    synthesize(samples[(std::size_t)SoundId::Hurt], {{Wave::Noise, 0.f, 0.f, 0.05f, 0.5f},
+                                                     {Wave::Square, 320.f, 90.f, 0.25f, 0.1f}});
+    synthesize(samples[(std::size_t)SoundId::Fall], {{Wave::Sine, 900.f, 120.f, 0.6f, 0.2f}});
+    synthesize(samples[(std::size_t)SoundId::Save], {{Wave::Triangle, 523.f, 523.f, 0.08f, 0.9f},
+                                                     {Wave::Triangle, 659.f, 659.f, 0.08f, 0.9f},
+                                                     {Wave::Triangle, 784.f, 784.f, 0.2f, 0.05f}});
+    synthesize(samples[(std::size_t)SoundId::Fail], {{Wave::Square, 150.f, 150.f, 0.1f, 0.5f},
+                                                     {Wave::Sine, 0.f, 0.f, 0.05f, 1.f}, // Silence
+                                                     {Wave::Square, 110.f, 110.f, 0.15f, 0.1f}});
+}
+
+// --- Member Function Implementations ---
+
+// Constructor
+AudioMixer::AudioMixer(const SoundBank& bank, unsigned int voiceCount)
+    : bank(bank), voices(std::max(1u, voiceCount)), accumulator(AUDIO_BUFFER_FRAMES)
+{
+}
+
+bool AudioMixer::post(const GameEvent& event) {
+    SoundId sound;
+    if (!getEventSound(event, sound)) return false;
+    // Coins rise in pitch with the score, so a run of them does not sound like one coin.
+    float pitch = sound == SoundId::Coin ? 1.f + 0.04f * (event.value % 8) : 1.f;
+    return play(sound, pitch);
+}
+
+bool AudioMixer::play(SoundId sound, float pitch) {
+    SoundRequest request;
+    request.sound = sound;
+    request.step = (std::uint32_t)(std::clamp(pitch, 0.5f, 2.f) * 65536.f);
+    if (!requests.push(request)) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+// Gives 'request' a voice, stealing one if it must.
+void AudioMixer::start(const SoundRequest& request) {
+    const SoundDesc& desc = getSoundDesc(request.sound);
+    Voice* chosen = nullptr;
+    Voice* oldestCopy = nullptr;
+    Voice* weakest = nullptr; // Lowest priority, then oldest
+    unsigned int copies = 0;
+    for (Voice& voice : voices) {
+        if (!voice.active) {
+            if (!chosen) chosen = &voice;
+            continue;
+        }
+        if (voice.sound == request.sound) {
+            copies++;
+            if (!oldestCopy || voice.startOrder < oldestCopy->startOrder) oldestCopy = &voice;
+        }
+        if (!weakest || voice.priority < weakest->priority ||
+            (voice.priority == weakest->priority && voice.startOrder < weakest->startOrder)) {
+            weakest = &voice;
+        }
+    }
+    if (copies >= desc.maxVoices) {
+        chosen = oldestCopy; // Restarting a copy of the same sound is not stealing
+    } else if (!chosen) {
+        if (weakest->priority > desc.priority) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        chosen = weakest;
+        stolen.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    chosen->active = true;
+    chosen->sound = request.sound;
+    chosen->priority = desc.priority;
+    chosen->startOrder = nextStartOrder++;
+    chosen->position = 0;
+    chosen->step = request.step;
+    chosen->gain = (std::int32_t)(desc.volume * 256.f);
+    started.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioMixer::mix(std::int16_t* out, std::size_t frames) {
+    SoundRequest request;
+    while (requests.pop(request)) {
+        start(request);
+    }
+
+    // In blocks of the accumulator's size, so mix() never allocates.
+    while (frames > 0) {
+        const std::size_t count = std::min(frames, accumulator.size());
+        std::fill(accumulator.begin(), accumulator.begin() + count, 0);
+        for (Voice& voice : voices) {
+            if (!voice.active) continue;
+            const std::vector<std::int16_t>& samples = bank.samples[(std::size_t)voice.sound];
+            const std::uint64_t end = (std::uint64_t)samples.size() << 16;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (voice.position + (1u << 16) >= end) { // Past the last pair to interpolate
+                    voice.active = false;
+                    break;
+                }
+                // Linear interpolation between the two source samples around the position.
+                std::size_t index = (std::size_t)(voice.position >> 16);
+                std::int32_t fraction = (std::int32_t)(voice.position & 0xFFFF);
+                std::int32_t a = samples[index], b = samples[index + 1];
+                std::int32_t value = a + (std::int32_t)(((std::int64_t)(b - a) * fraction) >> 16);
+                accumulator[i] += value * voice.gain;
+                voice.position += voice.step;
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = (std::int16_t)std::clamp(accumulator[i] >> 8, -32768, 32767);
+        }
+        out += count;
+        frames -= count;
+    }
+
+    unsigned int active = 0;
+    for (const Voice& voice : voices) {
+        active += voice.active ? 1 : 0;
+    }
+    activeVoices.store(active, std::memory_order_relaxed);
+}
+
+// Constructor
+NullAudioOutput::NullAudioOutput(AudioMixer& mixer)
+    : mixer(mixer)
+{
+}
+
+// Destructor
+NullAudioOutput::~NullAudioOutput() {
+    stop();
+}
+
+void NullAudioOutput::start() {
+    if (running.exchange(true)) return;
+    thread = std::thread(&NullAudioOutput::run, this);
+}
+
+void NullAudioOutput::stop() {
+    running = false;
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// Pulls one buffer per buffer duration, like a sound card would.
+void NullAudioOutput::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>((double)AUDIO_BUFFER_FRAMES / AUDIO_SAMPLE_RATE));
+    std::vector<std::int16_t> buffer(AUDIO_BUFFER_FRAMES);
+    Clock::time_point next = Clock::now();
+    while (running) {
+        mixer.mix(buffer.data(), buffer.size());
+        buffersMixed.fetch_add(1, std::memory_order_relaxed);
+        next += period;
+        if (next < Clock::now() - period * 4) {
+            next = Clock::now(); // Fell far behind (e.g. a debugger stop): don't catch up in a burst
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
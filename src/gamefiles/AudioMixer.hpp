@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "Constants.hpp"  // AUDIO_SAMPLE_RATE, AUDIO_VOICES, AUDIO_BUFFER_FRAMES
+#include "GameEvents.hpp" // The events that make sounds
+#include "SpscQueue.hpp"  // Requests from the game to the mixer
+
+// --- Sounds ---
+enum class SoundId : std::uint8_t {
+    Coin = 0,  // A pickup was collected
+    Hurt,      // The player hit an enemy or a hazard
+    Fall,      // The player fell out of the level
+    Save,      // Quicksave / quickload succeeded
+    Fail,      // Quicksave / quickload failed
+    Count
+};
+
+// How a sound competes for voices.
+struct SoundDesc {
+    const char* name;
+    std::uint8_t priority;  // Higher steals voices from lower
+    std::uint8_t maxVoices; // Copies that may play at once; more restart the oldest copy
+    float volume;           // 0..1
+};
+
+const SoundDesc& getSoundDesc(SoundId sound);
+
+// Which sound 'event' makes. Returns false if it makes none.
+bool getEventSound(const GameEvent& event, SoundId& sound);
+
+// Every sound, decoded to mono 16-bit samples at AUDIO_SAMPLE_RATE before the game starts,
+// so starting a sound never touches a file or allocates.
+struct SoundBank {
+    std::array<std::vector<std::int16_t>, (std::size_t)SoundId::Count> samples;
+};
+
+// Fills 'bank' with the built-in sounds (synthesized, the game ships no sound files).
+void synthesizeSoundBank(SoundBank& bank);
+
+// --- Mixer ---
+// Plays sounds from a SoundBank on a fixed pool of voices and mixes them into one stream.
+//
+// The game posts gameplay events from one thread (post() never blocks or allocates: it
+// pushes onto a lock-free SPSC queue, and a full queue drops the sound). The output pulls
+// mixed samples with mix() from one other thread, the audio thread, which is the only one
+// that touches the voices: it starts the queued sounds at the start of each buffer, then
+// mixes the playing voices.
+//
+// A sound gets a free voice if there is one. If 'maxVoices' copies of it are playing
+// already, it restarts the oldest copy instead (50 coins at once make 'maxVoices' coin
+// sounds, not 50). Otherwise it steals the voice of the lowest-priority sound (the oldest
+// among equals) if that priority is not above its own, and is dropped if it is.
+class AudioMixer {
+public:
+    explicit AudioMixer(const SoundBank& bank, unsigned int voiceCount = AUDIO_VOICES);
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    // --- Game thread ---
+    // Queues the sound of 'event', if it makes one. Returns false if it does not or the
+    // queue is full.
+    bool post(const GameEvent& event);
+    // Queues 'sound', played 'pitch' times as fast (0.5..2).
+    bool play(SoundId sound, float pitch = 1.f);
+
+    // --- Audio thread ---
+    // Starts the queued sounds, then writes the next 'frames' mixed samples to 'out'.
+    void mix(std::int16_t* out, std::size_t frames);
+
+    // --- Any thread ---
+    // Counters since construction.
+    std::uint64_t getSoundsStarted() const { return started.load(std::memory_order_relaxed); }
+    std::uint64_t getVoicesStolen() const { return stolen.load(std::memory_order_relaxed); }
+    std::uint64_t getSoundsDropped() const { return dropped.load(std::memory_order_relaxed); }
+    unsigned int getActiveVoices() const { return activeVoices.load(std::memory_order_relaxed); }
+    unsigned int getVoiceCount() const { return (unsigned int)voices.size(); }
+
+private:
+    struct SoundRequest {
+        SoundId sound = SoundId::Coin;
+        std::uint32_t step = 1u << 16; // Source samples per output sample, 16.16 fixed point
+    };
+
+    struct Voice {
+        bool active = false;
+        SoundId sound = SoundId::Coin;
+        std::uint8_t priority = 0;
+        std::uint64_t startOrder = 0;   // Larger started later
+        std::uint64_t position = 0;     // In source samples, 16.16 fixed point
+        std::uint32_t step = 1u << 16;
+        std::int32_t gain = 0;          // volume * 256
+    };
+
+    void start(const SoundRequest& request);
+
+    const SoundBank& bank;
+    SpscQueue<SoundRequest, 256> requests;
+    std::vector<Voice> voices;
+    std::vector<std::int32_t> accumulator; // One buffer of summed voices, reused by mix()
+    std::uint64_t nextStartOrder = 0;
+    std::atomic<std::uint64_t> started{0};
+    std::atomic<std::uint64_t> stolen{0};
+    std::atomic<std::uint64_t> dropped{0};  // No voice to take, or the queue was full
+    std::atomic<unsigned int> activeVoices{0};
+};
+
+// --- Null Output ---
+// Pulls AUDIO_BUFFER_FRAMES samples from a mixer at the real-time rate on its own thread and
+// throws them away: the whole path from event to mixed samples without an audio device,
+// for servers, tests and benchmarks.
+class NullAudioOutput {
+public:
+    explicit NullAudioOutput(AudioMixer& mixer);
+    ~NullAudioOutput(); // Stops the thread
+
+    NullAudioOutput(const NullAudioOutput&) = delete;
+    NullAudioOutput& operator=(const NullAudioOutput&) = delete;
+
+    void start();
+    // Joins the thread. Safe to call more than once.
+    void stop();
+
+    // Buffers pulled so far.
+    std::uint64_t getBuffersMixed() const { return buffersMixed.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    AudioMixer& mixer;
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<std::uint64_t> buffersMixed{0};
+};
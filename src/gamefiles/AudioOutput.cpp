@@ -0,0 +1,28 @@
+#include "AudioOutput.hpp" // Include the header definition for AudioDeviceOutput
+#include <SFML/Audio/SoundChannel.hpp> // For sf::SoundChannel
+
+// --- Member Function Implementations ---
+
+// Constructor
+AudioDeviceOutput::AudioDeviceOutput(AudioMixer& mixer)
+    : mixer(mixer), buffer(AUDIO_BUFFER_FRAMES)
+{
+    initialize(1, AUDIO_SAMPLE_RATE, {sf::SoundChannel::Mono});
+}
+
+// Destructor
+AudioDeviceOutput::~AudioDeviceOutput() {
+    stop(); // SFML's audio thread calls onGetData() until the stream stops
+}
+
+// Called on SFML's audio thread whenever it needs more samples. Never ends the stream.
+bool AudioDeviceOutput::onGetData(Chunk& data) {
+    mixer.mix(buffer.data(), buffer.size());
+    data.samples = buffer.data();
+    data.sampleCount = buffer.size();
+    return true;
+}
+
+// A live stream has nowhere to seek to.
+void AudioDeviceOutput::onSeek(sf::Time) {
+}
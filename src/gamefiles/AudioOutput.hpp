@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SFML/Audio/SoundStream.hpp> // The device stream the mixer feeds
+#include "AudioMixer.hpp"             // Where the samples come from
+
+// Plays an AudioMixer on the default audio device as one SFML sound stream. SFML pulls
+// AUDIO_BUFFER_FRAMES samples at a time from its audio thread, which is the mixer's audio
+// thread; no sf::Sound is ever created. Use NullAudioOutput where there is no device.
+class AudioDeviceOutput : public sf::SoundStream {
+public:
+    explicit AudioDeviceOutput(AudioMixer& mixer);
+    ~AudioDeviceOutput() override; // Stops the stream before the mixer can go
+
+private:
+    bool onGetData(Chunk& data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+    AudioMixer& mixer;
+    std::vector<std::int16_t> buffer; // Handed to SFML until the next onGetData()
+};
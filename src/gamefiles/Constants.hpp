@@ -4,14 +4,35 @@
 // Using constants makes the code easier to read and modify.
 
 // Physics Constants
-const float GRAVITY = 0.8f;           // Downward acceleration (pixels/frame^2)
-const float PLAYER_MOVE_SPEED = 5.0f;   // Horizontal speed (pixels/frame)
-const float PLAYER_JUMP_VELOCITY = -18.0f; // Initial jump velocity (pixels/frame, negative is up)
+const float GRAVITY = 0.8f;           // Downward acceleration (pixels/tick^2)
+const float PLAYER_MOVE_SPEED = 5.0f;   // Horizontal speed (pixels/tick)
+const float PLAYER_JUMP_VELOCITY = -18.0f; // Initial jump velocity (pixels/tick, negative is up)
+
+// Simulation Constants
+// All physics constants above are per tick; the simulation always advances in ticks of this length.
+const float SIM_TICK_SECONDS = 1.f / 60.f;  // Duration of one simulation tick (seconds)
+const float MAX_FRAME_SECONDS = 0.25f;      // Longest frame the game loop will try to catch up on (seconds)
+const int REWIND_TICKS = 600;               // History kept for rewinding (ticks, 10 seconds)
 
 // Tile Constants
 const int TILE_SIZE = 40;             // Width and height of each tile (pixels)
 const float COLLISION_EPSILON = 0.01f;  // Small offset for collision checks
+const int LEVEL_CHUNK_SIZE = 64;      // Width and height of a level chunk (tiles)
 
 // Window Constants
 const unsigned int WINDOW_WIDTH = 800;    // Width of the game window (pixels)
 const unsigned int WINDOW_HEIGHT = 600;   // Height of the game window (pixels)
+
+// Audio Constants
+const unsigned int AUDIO_SAMPLE_RATE = 44100;  // Mono 16-bit output (samples/second)
+const unsigned int AUDIO_VOICES = 8;           // Sounds that can play at once
+const unsigned int AUDIO_BUFFER_FRAMES = 512;  // Samples mixed per pull from the output (~12 ms)
+
+// Enemy AI Constants
+// Enemies jump like the player (same PLAYER_JUMP_VELOCITY and GRAVITY) but run slower.
+const float ENEMY_MOVE_SPEED = PLAYER_MOVE_SPEED * 0.6f; // Horizontal speed (pixels/tick)
+const float ENEMY_HALF_WIDTH = TILE_SIZE * 0.45f;   // Half extents of an enemy (pixels)
+const float ENEMY_HALF_HEIGHT = TILE_SIZE * 0.375f;
+const int FLOW_FIELD_HALF_WIDTH = 64;     // Tiles left/right of the player a flow field covers
+const int FLOW_FIELD_HALF_HEIGHT = 32;    // Tiles above/below the player a flow field covers
+const int FLOW_FIELD_LATENCY_TICKS = 4;   // Ticks between requesting a flow field and using it
@@ -0,0 +1,104 @@
+#include "EntityStore.hpp"   // Include the header definition for EntityStore
+#include "Constants.hpp"     // Include global constants like GRAVITY
+#include "TileCollision.hpp" // The per-body tile collision resolver
+
+// --- Member Function Implementations ---
+
+// Adds an entity and returns its index.
+std::size_t EntityStore::create(EntityKind kind, sf::Vector2f position, sf::Vector2f halfSize,
+                                std::uint8_t entityFlags, float gravity) {
+    posX.push_back(position.x);
+    posY.push_back(position.y);
+    velX.push_back(0.f);
+    velY.push_back(0.f);
+    halfW.push_back(halfSize.x);
+    halfH.push_back(halfSize.y);
+    gravityScale.push_back(gravity);
+    flags.push_back(entityFlags);
+    kinds.push_back(kind);
+    return size() - 1;
+}
+
+// Removes entity 'index' by moving the last entity into its slot.
+void EntityStore::remove(std::size_t index) {
+    std::size_t last = size() - 1;
+    if (index != last) {
+        posX[index] = posX[last];
+        posY[index] = posY[last];
+        velX[index] = velX[last];
+        velY[index] = velY[last];
+        halfW[index] = halfW[last];
+        halfH[index] = halfH[last];
+        gravityScale[index] = gravityScale[last];
+        flags[index] = flags[last];
+        kinds[index] = kinds[last];
+    }
+    posX.pop_back();
+    posY.pop_back();
+    velX.pop_back();
+    velY.pop_back();
+    halfW.pop_back();
+    halfH.pop_back();
+    gravityScale.pop_back();
+    flags.pop_back();
+    kinds.pop_back();
+}
+
+// Drops the entities from 'count' on, or adds zeroed ones up to it.
+void EntityStore::resize(std::size_t count) {
+    posX.resize(count);
+    posY.resize(count);
+    velX.resize(count);
+    velY.resize(count);
+    halfW.resize(count);
+    halfH.resize(count);
+    gravityScale.resize(count);
+    flags.resize(count);
+    kinds.resize(count);
+}
+
+// --- Batched Physics Passes ---
+// The two integration loops work on raw array pointers with no branches, which is the
+// shape compilers auto-vectorize (e.g. 8 entities per AVX instruction).
+
+// velY += GRAVITY * gravityScale for every entity.
+void applyGravity(EntityStore& entities) {
+    float* velY = entities.velY.data();
+    const float* gravityScale = entities.gravityScale.data();
+    const std::size_t count = entities.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        velY[i] += GRAVITY * gravityScale[i];
+    }
+}
+
+// Swept tile collision for every ENTITY_COLLIDES_TILES entity.
+void resolveTileCollisions(EntityStore& entities, const Level& level) {
+    const std::size_t count = entities.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!(entities.flags[i] & ENTITY_COLLIDES_TILES)) continue;
+        sf::Vector2f position = {entities.posX[i], entities.posY[i]};
+        sf::Vector2f velocity = {entities.velX[i], entities.velY[i]};
+        bool onGround = false;
+        resolveTileCollisionSwept(level, position, {entities.halfW[i], entities.halfH[i]}, velocity, onGround);
+        entities.posX[i] = position.x;
+        entities.posY[i] = position.y;
+        entities.velX[i] = velocity.x;
+        entities.velY[i] = velocity.y;
+        entities.setFlag(i, ENTITY_ON_GROUND, onGround);
+    }
+}
+
+// pos += vel for every entity.
+void integrate(EntityStore& entities) {
+    float* posX = entities.posX.data();
+    float* posY = entities.posY.data();
+    const float* velX = entities.velX.data();
+    const float* velY = entities.velY.data();
+    const std::size_t count = entities.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        posX[i] += velX[i];
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        posY[i] += velY[i];
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/System/Vector2.hpp> // For sf::Vector2f
+
+struct Level;
+
+// What an entity is, for game rules and rendering. Physics doesn't care.
+enum class EntityKind : std::uint8_t {
+    Player = 0,
+    Enemy = 1,
+    Projectile = 2,
+    Pickup = 3
+};
+
+// Per-entity flag bits stored in EntityStore::flags.
+enum EntityFlag : std::uint8_t {
+    ENTITY_ALIVE = 1 << 0,           // Unset entities are ignored by the game rules
+    ENTITY_ON_GROUND = 1 << 1,       // Standing on a solid tile (written by resolveTileCollisions)
+    ENTITY_COLLIDES_TILES = 1 << 2   // Takes part in resolveTileCollisions
+};
+
+// Structure-of-arrays store for every moving object in a level (player, enemies,
+// projectiles, pickups). Each property lives in its own contiguous array indexed by entity,
+// so the batched passes below stream through exactly the data they use and the simple
+// per-component loops can be vectorized by the compiler.
+//
+// Entity indices are stable until remove() is called; remove() moves the last entity into
+// the freed slot. Players are created first and never removed, so their indices never change.
+struct EntityStore {
+    // --- Member Variables (one element per entity) ---
+    std::vector<float> posX, posY;     // Center of the bounding box (pixels)
+    std::vector<float> velX, velY;     // Velocity (pixels/tick)
+    std::vector<float> halfW, halfH;   // Half extents of the bounding box (pixels)
+    std::vector<float> gravityScale;   // 1 for normal gravity, 0 for floating entities
+    std::vector<std::uint8_t> flags;   // EntityFlag bits
+    std::vector<EntityKind> kinds;     // What each entity is
+
+    // --- Member Functions ---
+    std::size_t size() const { return posX.size(); }
+
+    // Adds an entity and returns its index.
+    std::size_t create(EntityKind kind, sf::Vector2f position, sf::Vector2f halfSize, std::uint8_t entityFlags,
+                       float gravity = 1.f);
+    // Removes entity 'index' by moving the last entity into its slot.
+    void remove(std::size_t index);
+    // Drops the entities from 'count' on, or adds zeroed ones up to it (for restoring
+    // saved state, which then fills them in).
+    void resize(std::size_t count);
+
+    // Convenience accessors for code that handles one entity at a time.
+    sf::Vector2f getPosition(std::size_t index) const { return {posX[index], posY[index]}; }
+    void setPosition(std::size_t index, sf::Vector2f position) { posX[index] = position.x; posY[index] = position.y; }
+    sf::Vector2f getVelocity(std::size_t index) const { return {velX[index], velY[index]}; }
+    void setVelocity(std::size_t index, sf::Vector2f velocity) { velX[index] = velocity.x; velY[index] = velocity.y; }
+    sf::Vector2f getHalfSize(std::size_t index) const { return {halfW[index], halfH[index]}; }
+    bool hasFlag(std::size_t index, EntityFlag flag) const { return (flags[index] & flag) != 0; }
+    void setFlag(std::size_t index, EntityFlag flag, bool value) {
+        flags[index] = value ? (std::uint8_t)(flags[index] | flag) : (std::uint8_t)(flags[index] & ~flag);
+    }
+};
+
+// --- Batched Physics Passes (run in this order each tick) ---
+// velY += GRAVITY * gravityScale for every entity.
+void applyGravity(EntityStore& entities);
+// Swept tile collision (same rules as the player always had) for every ENTITY_COLLIDES_TILES
+// entity; updates positions/velocities on contact and the ENTITY_ON_GROUND flag.
+void resolveTileCollisions(EntityStore& entities, const Level& level);
+// pos += vel for every entity.
+void integrate(EntityStore& entities);
@@ -0,0 +1,110 @@
+#include "FileWatcher.hpp" // Include the header definition for FileWatcher
+#include <algorithm>       // For std::find
+#include <array>           // For the event buffer
+#include <iostream>        // For std::cerr
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>     // For std::strerror
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// "directory/name" of 'path', the key files are looked up by.
+std::string getWatchKey(const std::filesystem::path& directory, const std::string& name) {
+    return (directory / name).generic_string();
+}
+
+// Directory part of 'path', "." for bare file names.
+std::filesystem::path getDirectory(const std::string& path) {
+    std::filesystem::path directory = std::filesystem::path(path).lexically_normal().parent_path();
+    return directory.empty() ? std::filesystem::path(".") : directory;
+}
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Constructor
+FileWatcher::FileWatcher() {
+#if defined(__linux__)
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        std::cerr << "Warning: no file watching (inotify: " << std::strerror(errno) << "), hot reload is off"
+                  << std::endl;
+    }
+#else
+    lastScan = std::chrono::steady_clock::now();
+#endif
+}
+
+// Destructor
+FileWatcher::~FileWatcher() {
+#if defined(__linux__)
+    if (inotifyFd >= 0) {
+        ::close(inotifyFd);
+    }
+#endif
+}
+
+// Starts watching a file.
+void FileWatcher::watch(const std::string& path) {
+    std::filesystem::path directory = getDirectory(path);
+    std::string key = getWatchKey(directory, std::filesystem::path(path).filename().string());
+    if (!files.emplace(key, path).second) return; // Already watched
+
+#if defined(__linux__)
+    if (inotifyFd < 0) return;
+    // One watch per directory; adding the same directory again returns its descriptor.
+    int descriptor = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (descriptor >= 0) {
+        directories[descriptor] = directory.generic_string();
+    }
+#else
+    std::error_code error;
+    modified[key] = std::filesystem::last_write_time(key, error); // Stays the minimum if missing
+#endif
+}
+
+// Reports the watched files changed since the last call.
+void FileWatcher::poll(std::vector<std::string>& changed) {
+    std::size_t firstNew = changed.size();
+    auto report = [&](const std::string& key) {
+        auto file = files.find(key);
+        if (file != files.end() &&
+            std::find(changed.begin() + firstNew, changed.end(), file->second) == changed.end()) {
+            changed.push_back(file->second);
+        }
+    };
+
+#if defined(__linux__)
+    if (inotifyFd < 0) return;
+    alignas(inotify_event) std::array<char, 4096> buffer;
+    while (true) {
+        ssize_t length = ::read(inotifyFd, buffer.data(), buffer.size());
+        if (length <= 0) break; // EAGAIN: no more events
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+            offset += sizeof(inotify_event) + event->len;
+            auto directory = directories.find(event->wd);
+            if (directory != directories.end() && event->len > 0) {
+                report(getWatchKey(directory->second, event->name));
+            }
+        }
+    }
+#else
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastScan < std::chrono::seconds(1)) return;
+    lastScan = now;
+    for (auto& [key, time] : modified) {
+        std::error_code error;
+        std::filesystem::file_time_type current = std::filesystem::last_write_time(key, error);
+        if (!error && current != time) {
+            time = current;
+            report(key);
+        }
+    }
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+// Reports files that were changed on disk, for hot reloading. On Linux it uses inotify:
+// one watch per directory (so saves that replace the file, as most editors do, are seen
+// too), read without blocking, so poll() costs a single system call when nothing changed.
+// Elsewhere it compares modification times, at most once a second.
+// A file is reported once it has been written and closed, or renamed into place.
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Starts watching 'path', which need not exist yet (only its directory must).
+    void watch(const std::string& path);
+    // Appends every watched path changed since the last call to 'changed', each once, as
+    // passed to watch(). Never blocks.
+    void poll(std::vector<std::string>& changed);
+
+private:
+    std::map<std::string, std::string> files; // Watched "directory/name" -> path given to watch()
+#if defined(__linux__)
+    int inotifyFd = -1;
+    std::map<int, std::string> directories;   // Watch descriptor -> directory
+#else
+    std::map<std::string, std::filesystem::file_time_type> modified; // Last seen write times
+    std::chrono::steady_clock::time_point lastScan;
+#endif
+};
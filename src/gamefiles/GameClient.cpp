@@ -0,0 +1,191 @@
+#include "GameClient.hpp" // Include the header definition for the client
+#include "InputLog.hpp"   // INPUT_* masks, computeLevelChecksum
+#include <algorithm>      // For std::min, std::max
+#include <cmath>          // For std::hypot
+#include <iostream>       // For std::cerr
+#include <optional>       // For the sender of a received packet
+#include <utility>        // For std::move
+
+// --- Member Function Implementations ---
+
+// Constructor
+GameClient::GameClient(Level startLevel)
+    : level(std::move(startLevel)),
+      entities(),
+      player(entities, level.spawnPoint),
+      receiveBuffer(sf::UdpSocket::MaxDatagramSize)
+{
+    levelChecksum = computeLevelChecksum(level);
+}
+
+// Opens a socket and starts joining a room.
+bool GameClient::connect(sf::IpAddress server, unsigned short port, std::uint32_t room) {
+    if (socket.bind(sf::Socket::AnyPort) != sf::Socket::Status::Done) {
+        std::cerr << "Error connecting: cannot open a UDP socket" << std::endl;
+        return false;
+    }
+    socket.setBlocking(false);
+    serverAddress = server;
+    serverPort = port;
+    roomId = room;
+    connected = true;
+    joined = false;
+    ticksJoining = 0;
+    return true;
+}
+
+// Runs one client tick.
+void GameClient::update(const InputState& input) {
+    if (!connected) return;
+    receivePackets();
+    if (!joined) {
+        if (ticksJoining++ % NET_JOIN_RETRY_TICKS == 0) {
+            sendJoin(); // Join and Welcome can be lost too
+        }
+        return;
+    }
+
+    // --- Send ---
+    inputSeq++;
+    inputs[inputSeq % inputs.size()] = toInputMask(input);
+    sendInput();
+
+    // --- Predict ---
+    Player* body = &player;
+    stepPlayers(&body, &input, 1, entities, level);
+}
+
+// Reads every packet waiting on the socket.
+void GameClient::receivePackets() {
+    while (true) {
+        std::size_t received = 0;
+        std::optional<sf::IpAddress> sender;
+        unsigned short port = 0;
+        if (socket.receive(receiveBuffer.data(), receiveBuffer.size(), received, sender, port) !=
+                sf::Socket::Status::Done || !sender) {
+            break; // NotReady: nothing left to read
+        }
+        if (*sender != serverAddress || port != serverPort) continue;
+        if (isLost()) continue;
+        bytesReceived += received;
+
+        NetReader reader(receiveBuffer.data(), received);
+        std::uint8_t type = 0;
+        reader.readU8(type);
+        if (type == (std::uint8_t)PacketType::Welcome) {
+            handleWelcome(reader);
+        } else if (type == (std::uint8_t)PacketType::State && joined) {
+            handleState(receiveBuffer.data(), received);
+        }
+    }
+}
+
+// Handles the server's answer to our Join.
+void GameClient::handleWelcome(NetReader& reader) {
+    std::uint32_t room = 0;
+    std::uint8_t id = NET_NO_PLAYER;
+    std::uint64_t checksum = 0;
+    reader.readU32(room);
+    reader.readU8(id);
+    reader.readU64(checksum);
+    if (!reader.isOk() || room != roomId || joined) return;
+
+    if (id == NET_NO_PLAYER) {
+        std::cerr << "Error joining room " << room << ": the room is full, or the server has no rooms left" << std::endl;
+        connected = false;
+        return;
+    }
+    if (checksum != levelChecksum) {
+        std::cerr << "Error joining room " << room << ": the server runs a different level" << std::endl;
+        connected = false;
+        return;
+    }
+    playerId = id;
+    joined = true;
+}
+
+// Applies a state from the server and reconciles the local player with it.
+void GameClient::handleState(const std::uint8_t* data, std::size_t size) {
+    if (!decodeState(data, size, history, message) || message.tick <= newestTick) {
+        return; // Malformed, against a baseline we lack, or older than one we have
+    }
+    statesReceived++;
+    bool firstState = newestTick == 0;
+    newestTick = message.tick;
+    history.store(message.tick, message.players);
+
+    for (const NetTile& tile : message.tiles) {
+        if (level.getTile(tile.x, tile.y) != tile.type) {
+            level.setTile(tile.x, tile.y, tile.type);
+        }
+    }
+
+    remotePlayers.clear();
+    const NetPlayerState* own = nullptr;
+    for (const NetPlayerState& state : message.players) {
+        if (state.id == playerId) {
+            own = &state;
+        } else {
+            remotePlayers.push_back(state);
+        }
+    }
+    if (!own) return;
+
+    // --- Reconcile ---
+    // Start from the server's state after input lastInputSeq and replay the inputs since.
+    sf::Vector2f predicted = player.getPosition(entities);
+    applyPlayerState(*own, player, entities);
+    std::uint32_t firstSeq = message.lastInputSeq + 1;
+    if (inputSeq >= inputs.size() && firstSeq <= inputSeq - inputs.size()) {
+        firstSeq = inputSeq - (std::uint32_t)inputs.size() + 1; // Older inputs are gone
+    }
+    Player* body = &player;
+    for (std::uint32_t seq = firstSeq; seq <= inputSeq; ++seq) {
+        InputState input = fromInputMask(inputs[seq % inputs.size()]);
+        stepPlayers(&body, &input, 1, entities, level);
+    }
+    if (firstState) return; // Nothing was predicted yet, so nothing was corrected
+    sf::Vector2f corrected = player.getPosition(entities);
+    float correction = std::hypot(corrected.x - predicted.x, corrected.y - predicted.y);
+    reconciliations++;
+    correctionTotal += correction;
+    correctionMax = std::max(correctionMax, correction);
+}
+
+// Asks the server for a slot in our room.
+void GameClient::sendJoin() {
+    sendBuffer.clear();
+    NetWriter writer(sendBuffer);
+    writer.writeU8((std::uint8_t)PacketType::Join);
+    writer.writeU32(NET_PROTOCOL_MAGIC);
+    writer.writeU32(roomId);
+    sendPacket();
+}
+
+// Sends the newest inputs, newest first, with the newest state we have.
+void GameClient::sendInput() {
+    std::uint32_t count = std::min<std::uint32_t>(inputSeq, NET_INPUT_REDUNDANCY);
+    sendBuffer.clear();
+    NetWriter writer(sendBuffer);
+    writer.writeU8((std::uint8_t)PacketType::Input);
+    writer.writeVarint(newestTick);
+    writer.writeVarint(inputSeq);
+    writer.writeU8((std::uint8_t)count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        writer.writeU8(inputs[(inputSeq - i) % inputs.size()]);
+    }
+    sendPacket();
+}
+
+// Sends sendBuffer to the server, counting its bytes.
+void GameClient::sendPacket() {
+    if (isLost()) return;
+    if (socket.send(sendBuffer.data(), sendBuffer.size(), serverAddress, serverPort) == sf::Socket::Status::Done) {
+        bytesSent += sendBuffer.size();
+    }
+}
+
+// Should the packet being sent or received be dropped (setSimulatedLoss)?
+bool GameClient::isLost() {
+    return simulatedLoss > 0.f && std::uniform_real_distribution<float>(0.f, 1.f)(lossRandom) < simulatedLoss;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <SFML/Network/IpAddress.hpp> // Server address
+#include <SFML/Network/UdpSocket.hpp> // Connection to the server
+#include "EntityStore.hpp"            // The local player's body
+#include "Level.hpp"                  // Local copy of the room's level
+#include "NetProtocol.hpp"            // Wire format, state history
+#include "Player.hpp"                 // The local player
+#include "Simulation.hpp"             // InputState
+
+// --- Client ---
+// One player in a GameServer room. The local player moves as soon as an input is given
+// (prediction), with the same stepPlayers() code the server runs. Each state from the
+// server then puts it where the server had it after the newest input the server applied,
+// and replays the inputs sent since (reconciliation). Where prediction was right, this
+// changes nothing beyond rounding; where it was wrong (e.g. the server skipped inputs),
+// the player is corrected to the server's version. Other players are shown as of the
+// newest state received.
+class GameClient {
+public:
+    // 'level' must be the level the server runs (checked against its Welcome).
+    explicit GameClient(Level level);
+
+    // Opens a socket and starts joining room 'room' on the server at 'server':'port'.
+    // Prints the problem to std::cerr and returns false if no socket can be opened.
+    bool connect(sf::IpAddress server, unsigned short port, std::uint32_t room);
+    // Runs one client tick: reads the server's packets, then sends 'input' and predicts
+    // its effect. Call once per SIM_TICK_SECONDS, like Simulation::step.
+    void update(const InputState& input);
+
+    // Has the server welcomed us into the room?
+    bool isJoined() const { return joined; }
+    const Level& getLevel() const { return level; }
+    const EntityStore& getEntities() const { return entities; }
+    const Player& getPlayer() const { return player; }
+    // The other players in the room, as of the newest state received.
+    const std::vector<NetPlayerState>& getRemotePlayers() const { return remotePlayers; }
+
+    // Drops this fraction (0..1) of the packets sent and received, to test the protocol
+    // under loss.
+    // 'seed' picks which ones, so clients given different seeds lose different packets.
+    void setSimulatedLoss(float fraction, std::uint32_t seed) {
+        simulatedLoss = fraction;
+        lossRandom.seed(seed);
+    }
+
+    // --- Statistics ---
+    std::uint64_t getBytesSent() const { return bytesSent; }
+    std::uint64_t getBytesReceived() const { return bytesReceived; }
+    std::uint64_t getStatesReceived() const { return statesReceived; }
+    // How far reconciliation moved the local player from where prediction had it (pixels).
+    std::uint64_t getReconciliations() const { return reconciliations; }
+    double getCorrectionTotal() const { return correctionTotal; }
+    float getCorrectionMax() const { return correctionMax; }
+
+private:
+    void receivePackets();
+    void handleWelcome(NetReader& reader);
+    void handleState(const std::uint8_t* data, std::size_t size);
+    void sendJoin();
+    void sendInput();
+    void sendPacket();
+    bool isLost();
+
+    Level level;
+    std::uint64_t levelChecksum = 0;
+    EntityStore entities;
+    Player player;
+
+    sf::UdpSocket socket;
+    sf::IpAddress serverAddress = sf::IpAddress::Any;
+    unsigned short serverPort = 0;
+    std::uint32_t roomId = 0;
+    bool connected = false;         // connect() succeeded and the server has not refused us
+    bool joined = false;            // Welcomed into the room
+    std::uint8_t playerId = NET_NO_PLAYER;
+    std::uint64_t ticksJoining = 0; // Ticks since connect(), until welcomed
+
+    std::array<std::uint8_t, 64> inputs{}; // Sent INPUT_* masks by sequence number % 64
+    std::uint32_t inputSeq = 0;            // Newest input sent (the first is 1)
+    std::uint64_t newestTick = 0;          // Newest state received, acknowledged to the server
+    NetStateHistory history;               // Received states, as baselines for the next ones
+    StateMessage message;                  // Decoding space, reused
+    std::vector<NetPlayerState> remotePlayers;
+
+    std::vector<std::uint8_t> receiveBuffer;
+    std::vector<std::uint8_t> sendBuffer;
+    float simulatedLoss = 0.f;
+    std::mt19937 lossRandom;
+
+    std::uint64_t bytesSent = 0;
+    std::uint64_t bytesReceived = 0;
+    std::uint64_t statesReceived = 0;
+    std::uint64_t reconciliations = 0;
+    double correctionTotal = 0.0;
+    float correctionMax = 0.f;
+};
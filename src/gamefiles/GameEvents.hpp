@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include "SpscQueue.hpp" // The lock-free queue events travel through
+
+// Gameplay events published by the simulation for the presentation side (logging, sound,
+// effects) to consume, so the frame loop never does I/O inside a tick.
+enum class GameEventType : std::uint8_t {
+    CoinCollected = 0,   // A pickup tile (coin, gem) or pickup entity was collected
+    PlayerFellOut = 1,   // The player fell out of the level and respawned
+    PlayerHitEnemy = 2,  // The player touched an enemy and respawned
+    PlayerHitHazard = 3, // The player touched a hazard tile (spikes) and respawned
+    QuickSaved = 4,      // The state was saved (value = 0) or could not be (value = -1)
+    QuickLoaded = 5      // The saved state was loaded (value = 0) or there was none (-1)
+};
+
+struct GameEvent {
+    GameEventType type = GameEventType::CoinCollected;
+    std::uint64_t tick = 0; // Simulation tick the event happened on
+    std::int32_t x = 0;     // Tile coordinates: the coin tile, otherwise the player's tile
+    std::int32_t y = 0;     // at the end of the tick (the respawn point after a death)
+    std::int32_t value = 0; // Event-specific: the new score for CoinCollected
+};
+
+// Capacity covers several seconds of worst-case events between drains; when full, new
+// events are dropped rather than stalling the simulation.
+using GameEventQueue = SpscQueue<GameEvent, 1024>;
+
+// Pushes 'event' if there is a queue to push to. Never blocks: a full queue drops the event.
+inline void publishEvent(GameEventQueue* queue, const GameEvent& event) {
+    if (queue) queue->push(event);
+}
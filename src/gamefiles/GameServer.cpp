@@ -0,0 +1,318 @@
+#include "GameServer.hpp" // Include the header definition for the server
+#include "InputLog.hpp"   // INPUT_* masks, computeLevelChecksum
+#include "Simulation.hpp" // stepPlayers, handleCoinCollection
+#include <algorithm>      // For std::min
+#include <chrono>         // For timing room steps
+#include <iostream>       // For std::cerr
+#include <optional>       // For the sender of a received packet
+
+// --- Room ---
+
+// Constructor
+Room::Room(std::uint32_t roomId, const Level& startLevel)
+    : id(roomId),
+      level(startLevel)
+{
+    level.recordTileChanges = true;
+    level.tileChanges.clear();
+}
+
+// Gives a client a player slot.
+std::uint8_t Room::join(sf::IpAddress address, unsigned short port) {
+    std::size_t slot = 0;
+    while (slot < players.size() && players[slot].active) slot++;
+    if (slot == NET_MAX_ROOM_PLAYERS) return NET_NO_PLAYER;
+    if (slot == players.size()) {
+        players.emplace_back(entities, level.spawnPoint);
+    }
+
+    RoomPlayer& joined = players[slot];
+    joined.active = true;
+    joined.address = address;
+    joined.port = port;
+    joined.newestInputSeq = 0;
+    joined.appliedInputSeq = 0;
+    joined.heldKeys = 0;
+    joined.ackTick = 0;
+    joined.lastHeardTick = tick;
+    joined.player.score = 0;
+    entities.setPosition(joined.player.entity, level.spawnPoint);
+    entities.setVelocity(joined.player.entity, {0.f, 0.f});
+    return (std::uint8_t)slot;
+}
+
+// Frees a player slot.
+void Room::leave(std::uint8_t playerId) {
+    RoomPlayer& left = players[playerId];
+    left.active = false;
+    left.heldKeys = 0;
+    entities.setPosition(left.player.entity, level.spawnPoint);
+    entities.setVelocity(left.player.entity, {0.f, 0.f});
+}
+
+// Stores the inputs of an Input packet.
+void Room::receiveInputs(std::uint8_t playerId, std::uint64_t ackTick, std::uint32_t newestSeq,
+                         const std::uint8_t* masks, std::uint8_t count) {
+    RoomPlayer& sender = players[playerId];
+    sender.lastHeardTick = tick;
+    if (ackTick > sender.ackTick && ackTick <= tick) {
+        sender.ackTick = ackTick;
+    }
+    if (newestSeq <= sender.newestInputSeq) return; // Reordered or duplicated packet
+
+    // Inputs older than this packet's oldest that never arrived are lost for good; the
+    // player simply skips them.
+    count = (std::uint8_t)std::min<std::uint32_t>(count, newestSeq);
+    std::uint32_t oldestSeq = newestSeq - count + 1;
+    if (oldestSeq > sender.newestInputSeq + 1 && sender.appliedInputSeq < oldestSeq - 1) {
+        sender.appliedInputSeq = oldestSeq - 1;
+    }
+    for (std::uint8_t i = 0; i < count; ++i) {
+        std::uint32_t seq = newestSeq - i;
+        if (seq <= sender.newestInputSeq) break;
+        sender.inputs[seq % sender.inputs.size()] = masks[i];
+    }
+    sender.newestInputSeq = newestSeq;
+}
+
+// Advances the room by one tick.
+void Room::step() {
+    tick++;
+
+    // --- Input ---
+    // One input per player per tick. A player whose next input has not arrived keeps
+    // walking the way it was (but does not jump); one that has fallen too far behind
+    // skips its oldest inputs, so its lag stays bounded.
+    std::array<Player*, NET_MAX_ROOM_PLAYERS> bodies;
+    std::array<InputState, NET_MAX_ROOM_PLAYERS> inputs;
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        RoomPlayer& roomPlayer = players[i];
+        std::uint8_t mask = roomPlayer.heldKeys;
+        if (roomPlayer.active && roomPlayer.newestInputSeq > roomPlayer.appliedInputSeq) {
+            if (roomPlayer.newestInputSeq - roomPlayer.appliedInputSeq > NET_MAX_INPUT_BACKLOG) {
+                roomPlayer.appliedInputSeq = roomPlayer.newestInputSeq - NET_MAX_INPUT_BACKLOG;
+            }
+            roomPlayer.appliedInputSeq++;
+            mask = roomPlayer.inputs[roomPlayer.appliedInputSeq % roomPlayer.inputs.size()];
+            roomPlayer.heldKeys = mask & (INPUT_LEFT | INPUT_RIGHT);
+        }
+        bodies[i] = &roomPlayer.player;
+        inputs[i] = fromInputMask(mask);
+    }
+
+    // --- Physics and Pickups ---
+    stepPlayers(bodies.data(), inputs.data(), players.size(), entities, level);
+    for (RoomPlayer& roomPlayer : players) {
+        if (roomPlayer.active) {
+            handleCoinCollection(roomPlayer.player, entities, level);
+        }
+    }
+
+    // --- Tile History ---
+    for (const TileChange& change : level.tileChanges) {
+        NetTile tile;
+        tile.x = change.x;
+        tile.y = change.y;
+        tile.type = change.type;
+        recentTiles.emplace_back(tick, tile);
+        std::uint64_t key = ((std::uint64_t)(std::uint32_t)tile.y << 32) | (std::uint32_t)tile.x;
+        auto found = changedTileIndex.find(key);
+        if (found == changedTileIndex.end()) {
+            changedTileIndex.emplace(key, changedTiles.size());
+            changedTiles.push_back(tile);
+        } else {
+            changedTiles[found->second].type = tile.type;
+        }
+    }
+    level.tileChanges.clear();
+    while (!recentTiles.empty() && recentTiles.front().first + NET_HISTORY_TICKS <= tick) {
+        recentTiles.pop_front();
+    }
+
+    // --- Player History ---
+    states.clear();
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        if (players[i].active) {
+            states.push_back(capturePlayerState(players[i].player, entities, (std::uint8_t)i));
+        }
+    }
+    history.store(tick, states);
+}
+
+// Builds each active player's State packet.
+void Room::buildPackets(bool deltaCompression) {
+    StateMessage message;
+    message.tick = tick;
+    message.players = states;
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        RoomPlayer& roomPlayer = players[i];
+        if (!roomPlayer.active) continue;
+        message.lastInputSeq = roomPlayer.appliedInputSeq;
+        message.localPlayer = (std::uint8_t)i;
+
+        // Delta against the newest state the client has, if it is still in the history;
+        // otherwise the whole state, with every tile changed since the start.
+        const std::vector<NetPlayerState>* base = deltaCompression ? history.find(roomPlayer.ackTick) : nullptr;
+        message.tiles.clear();
+        if (base) {
+            message.baseTick = roomPlayer.ackTick;
+            message.allTiles = false;
+            for (const auto& recent : recentTiles) {
+                if (recent.first > roomPlayer.ackTick) {
+                    message.tiles.push_back(recent.second);
+                }
+            }
+        } else {
+            message.baseTick = 0;
+            message.allTiles = true;
+            message.tiles = changedTiles;
+        }
+        roomPlayer.outgoing.clear();
+        encodeState(message, base, roomPlayer.outgoing);
+    }
+}
+
+// --- GameServer ---
+
+// Constructor
+GameServer::GameServer(Level level, unsigned int threadCount)
+    : startLevel(std::move(level)),
+      pool(threadCount),
+      receiveBuffer(sf::UdpSocket::MaxDatagramSize)
+{
+    levelChecksum = computeLevelChecksum(startLevel);
+}
+
+// Binds the socket.
+bool GameServer::start(unsigned short port) {
+    if (socket.bind(port) != sf::Socket::Status::Done) {
+        std::cerr << "Error starting server: cannot bind UDP port " << port << std::endl;
+        return false;
+    }
+    socket.setBlocking(false);
+    return true;
+}
+
+// Reads every waiting packet.
+void GameServer::receivePackets() {
+    while (true) {
+        std::size_t received = 0;
+        std::optional<sf::IpAddress> sender;
+        unsigned short port = 0;
+        if (socket.receive(receiveBuffer.data(), receiveBuffer.size(), received, sender, port) !=
+                sf::Socket::Status::Done || !sender) {
+            break; // NotReady: nothing left to read
+        }
+        bytesReceived += received;
+
+        NetReader reader(receiveBuffer.data(), received);
+        std::uint8_t type = 0;
+        reader.readU8(type);
+        if (type == (std::uint8_t)PacketType::Join) {
+            handleJoin(reader, *sender, port);
+        } else if (type == (std::uint8_t)PacketType::Input) {
+            auto client = clients.find(getClientKey(*sender, port));
+            if (client == clients.end()) continue; // Not joined (or timed out)
+            std::uint64_t ackTick = 0, newestSeq = 0;
+            std::uint8_t count = 0;
+            std::array<std::uint8_t, NET_INPUT_REDUNDANCY> masks{};
+            reader.readVarint(ackTick);
+            reader.readVarint(newestSeq);
+            reader.readU8(count);
+            count = (std::uint8_t)std::min<std::uint32_t>(count, NET_INPUT_REDUNDANCY);
+            for (std::uint8_t i = 0; i < count; ++i) {
+                reader.readU8(masks[i]);
+            }
+            if (!reader.isOk()) continue;
+            rooms[client->second.room]->receiveInputs(client->second.player, ackTick, (std::uint32_t)newestSeq,
+                                                      masks.data(), count);
+        }
+    }
+}
+
+// Handles a Join packet: puts the client in its room and welcomes it.
+void GameServer::handleJoin(NetReader& reader, sf::IpAddress address, unsigned short port) {
+    std::uint32_t magic = 0, roomId = 0;
+    reader.readU32(magic);
+    reader.readU32(roomId);
+    if (!reader.isOk() || magic != NET_PROTOCOL_MAGIC) return;
+
+    std::uint64_t key = getClientKey(address, port);
+    auto client = clients.find(key);
+    std::uint8_t playerId = NET_NO_PLAYER;
+    if (client != clients.end() && rooms[client->second.room]->id == roomId) {
+        playerId = client->second.player; // Our Welcome was lost; send it again
+    } else {
+        if (client != clients.end()) { // Moving to another room
+            rooms[client->second.room]->leave(client->second.player);
+            clients.erase(client);
+        }
+        auto found = roomIndex.find(roomId);
+        if (found == roomIndex.end() && rooms.size() < maxRooms) {
+            found = roomIndex.emplace(roomId, rooms.size()).first;
+            rooms.push_back(std::make_unique<Room>(roomId, startLevel));
+        }
+        if (found != roomIndex.end()) { // Otherwise out of rooms: refused like a full room
+            playerId = rooms[found->second]->join(address, port);
+        }
+        if (playerId != NET_NO_PLAYER) {
+            clients[key] = {found->second, playerId};
+        }
+    }
+
+    sendBuffer.clear();
+    NetWriter writer(sendBuffer);
+    writer.writeU8((std::uint8_t)PacketType::Welcome);
+    writer.writeU32(roomId);
+    writer.writeU8(playerId);
+    writer.writeU64(levelChecksum);
+    sendPacket(sendBuffer, address, port);
+}
+
+// Advances every room by one tick and sends the new states.
+void GameServer::tick() {
+    receivePackets();
+
+    // --- Step Rooms ---
+    // Each task touches only its own room; the socket is used from this thread alone.
+    bool delta = deltaCompression;
+    for (const std::unique_ptr<Room>& room : rooms) {
+        Room* roomPtr = room.get();
+        pool.submit([roomPtr, delta] {
+            auto start = std::chrono::steady_clock::now();
+            roomPtr->step();
+            roomPtr->buildPackets(delta);
+            roomPtr->stepMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        });
+    }
+    pool.waitIdle();
+
+    // --- Send States ---
+    roomStepMicros.clear();
+    for (const std::unique_ptr<Room>& room : rooms) {
+        roomStepMicros.push_back((float)room->stepMicros);
+        for (const RoomPlayer& roomPlayer : room->players) {
+            if (roomPlayer.active) {
+                sendPacket(roomPlayer.outgoing, roomPlayer.address, roomPlayer.port);
+            }
+        }
+    }
+
+    // --- Timeouts ---
+    for (auto client = clients.begin(); client != clients.end();) {
+        Room& room = *rooms[client->second.room];
+        if (room.tick > room.players[client->second.player].lastHeardTick + NET_TIMEOUT_TICKS) {
+            room.leave(client->second.player);
+            client = clients.erase(client);
+        } else {
+            ++client;
+        }
+    }
+}
+
+// Sends one packet, counting its bytes.
+void GameServer::sendPacket(const std::vector<std::uint8_t>& bytes, sf::IpAddress address, unsigned short port) {
+    if (socket.send(bytes.data(), bytes.size(), address, port) == sf::Socket::Status::Done) {
+        bytesSent += bytes.size();
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <SFML/Network/IpAddress.hpp> // Client addresses
+#include <SFML/Network/UdpSocket.hpp> // The server's one socket
+#include "EntityStore.hpp"            // Bodies of a room's players
+#include "Level.hpp"                  // Each room's copy of the level
+#include "NetProtocol.hpp"            // Wire format, state history
+#include "Player.hpp"                 // Room players
+#include "ThreadPool.hpp"             // Rooms tick in parallel
+
+// --- Rooms ---
+// One client's player in a room. Slots are reused: a player that times out is parked at
+// the spawn point until someone else joins.
+struct RoomPlayer {
+    Player player;
+    bool active = false;
+    sf::IpAddress address = sf::IpAddress::Any;
+    unsigned short port = 0;
+    std::array<std::uint8_t, 32> inputs{}; // INPUT_* masks by sequence number % 32
+    std::uint32_t newestInputSeq = 0;      // Newest input received
+    std::uint32_t appliedInputSeq = 0;     // Newest input applied to the player
+    std::uint8_t heldKeys = 0;             // Left/right of the last applied input
+    std::uint64_t ackTick = 0;             // Newest state the client has (0 = none)
+    std::uint64_t lastHeardTick = 0;       // Room tick of the last packet from the client
+    std::vector<std::uint8_t> outgoing;    // State packet built this tick
+
+    explicit RoomPlayer(EntityStore& entities, sf::Vector2f spawn) : player(entities, spawn) {}
+};
+
+// An independent game: a level and up to NET_MAX_ROOM_PLAYERS players in it. A room
+// only touches its own data, so the server steps all rooms in parallel. Players do not
+// collide with each other; they share the level and race for its coins.
+struct Room {
+    // --- Member Variables ---
+    std::uint32_t id = 0;
+    Level level;                     // The room's copy; players collect its coins
+    EntityStore entities;            // One body per player slot
+    std::vector<RoomPlayer> players; // Index = player id
+    std::uint64_t tick = 0;          // Ticks stepped (states sent so far are 1..tick)
+    NetStateHistory history;         // Player states of the recent ticks, as delta baselines
+    std::deque<std::pair<std::uint64_t, NetTile>> recentTiles; // Tiles set in the last
+                                                               // NET_HISTORY_TICKS ticks
+    std::vector<NetTile> changedTiles;  // Every tile set since the start, newest type only
+    std::unordered_map<std::uint64_t, std::size_t> changedTileIndex; // Position -> changedTiles
+    std::vector<NetPlayerState> states; // Active players after the last step
+    double stepMicros = 0.0;            // Time the last step and its packets took
+
+    // --- Member Functions (Declarations) ---
+    Room(std::uint32_t roomId, const Level& startLevel);
+
+    // Gives a client a player slot. Returns its id, or NET_NO_PLAYER if the room is full.
+    std::uint8_t join(sf::IpAddress address, unsigned short port);
+    // Frees a player's slot and parks its body at the spawn point.
+    void leave(std::uint8_t playerId);
+    // Stores the inputs of an Input packet from player 'playerId'.
+    void receiveInputs(std::uint8_t playerId, std::uint64_t ackTick, std::uint32_t newestSeq,
+                       const std::uint8_t* masks, std::uint8_t count);
+    // Applies one input per active player and advances the room by one tick.
+    void step();
+    // Builds each active player's State packet into RoomPlayer::outgoing. With
+    // 'deltaCompression' off every state is sent whole, for comparison.
+    void buildPackets(bool deltaCompression);
+};
+
+// --- Server ---
+// Authoritative multiplayer server: every room is simulated here and clients only send
+// their inputs. One UDP socket serves every client. Each tick() reads every waiting
+// packet, steps the rooms on a thread pool and sends every client the state of its room.
+class GameServer {
+public:
+    // Rooms are created on first join, each with its own copy of 'level'.
+    GameServer(Level level, unsigned int threadCount = 0);
+
+    // Binds the socket to 'port' (0 = any free port). Prints the problem to std::cerr
+    // and returns false if it cannot.
+    bool start(unsigned short port);
+    unsigned short getPort() const { return socket.getLocalPort(); }
+
+    // Reads every packet waiting on the socket. tick() calls this first; calling it more
+    // often keeps the socket's buffer from overflowing with many clients.
+    void receivePackets();
+    // Advances every room by one tick and sends the new states.
+    void tick();
+
+    // Sends every state whole instead of as a delta (for measuring the difference).
+    void setDeltaCompression(bool enabled) { deltaCompression = enabled; }
+    // Most rooms the server will open (at least 1). Rooms are never closed, and each
+    // holds a copy of the level, so a Join for a new room past the limit is refused.
+    void setMaxRooms(std::size_t count) { maxRooms = std::max<std::size_t>(count, 1); }
+
+    // --- Statistics ---
+    std::size_t getRoomCount() const { return rooms.size(); }
+    std::size_t getClientCount() const { return clients.size(); }
+    // Microseconds each room's step (with its packets) took in the last tick, by room.
+    const std::vector<float>& getRoomStepMicros() const { return roomStepMicros; }
+    std::uint64_t getBytesSent() const { return bytesSent; }
+    std::uint64_t getBytesReceived() const { return bytesReceived; }
+
+private:
+    // A joined client: the room it is in and its player id there.
+    struct ClientSlot {
+        std::size_t room = 0;
+        std::uint8_t player = 0;
+    };
+
+    static std::uint64_t getClientKey(sf::IpAddress address, unsigned short port) {
+        return ((std::uint64_t)address.toInteger() << 16) | port;
+    }
+    void handleJoin(NetReader& reader, sf::IpAddress address, unsigned short port);
+    void sendPacket(const std::vector<std::uint8_t>& bytes, sf::IpAddress address, unsigned short port);
+
+    Level startLevel;
+    std::uint64_t levelChecksum = 0;
+    sf::UdpSocket socket;
+    ThreadPool pool;
+    bool deltaCompression = true;
+    std::size_t maxRooms = NET_DEFAULT_MAX_ROOMS;
+    std::vector<std::unique_ptr<Room>> rooms;         // unique_ptr: tasks hold Room pointers
+    std::unordered_map<std::uint32_t, std::size_t> roomIndex; // Room id -> rooms
+    std::map<std::uint64_t, ClientSlot> clients;      // By getClientKey()
+    std::vector<std::uint8_t> receiveBuffer;
+    std::vector<std::uint8_t> sendBuffer;
+    std::vector<float> roomStepMicros;
+    std::uint64_t bytesSent = 0;
+    std::uint64_t bytesReceived = 0;
+};
@@ -0,0 +1,143 @@
+#include "Hud.hpp"        // Include the header definition for Hud
+#include <algorithm>      // For std::max, std::min
+#include <SFML/Graphics/PrimitiveType.hpp> // For sf::PrimitiveType
+#include <SFML/Graphics/RenderStates.hpp>  // For binding the glyph texture
+
+namespace {
+
+// Same padding sf::Text puts around glyph quads, so edge pixels aren't clipped.
+const float GLYPH_PADDING = 1.f;
+const std::size_t VERTICES_PER_QUAD = 6;
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Constructor: fetches the digit glyphs once, which also puts them in the font texture.
+Hud::Hud(const sf::Font& font, unsigned int characterSize)
+    : font(font), characterSize(characterSize)
+{
+    for (int digit = 0; digit < 10; ++digit) {
+        digitGlyphs[digit] = makeGlyphQuad(U'0' + digit);
+        digitAdvance = std::max(digitAdvance, digitGlyphs[digit].advance);
+    }
+    digitGlyphs[10] = makeGlyphQuad(U'-');
+}
+
+// Looks up a glyph and turns it into a padded quad relative to the pen position.
+Hud::GlyphQuad Hud::makeGlyphQuad(char32_t character) const {
+    const sf::Glyph& glyph = font.getGlyph(character, characterSize, false);
+    GlyphQuad quad;
+    quad.advance = glyph.advance;
+    quad.bounds = {{glyph.bounds.position.x - GLYPH_PADDING, glyph.bounds.position.y - GLYPH_PADDING},
+                   {glyph.bounds.size.x + 2 * GLYPH_PADDING, glyph.bounds.size.y + 2 * GLYPH_PADDING}};
+    quad.texture = {{(float)glyph.textureRect.position.x - GLYPH_PADDING, (float)glyph.textureRect.position.y - GLYPH_PADDING},
+                    {(float)glyph.textureRect.size.x + 2 * GLYPH_PADDING, (float)glyph.textureRect.size.y + 2 * GLYPH_PADDING}};
+    return quad;
+}
+
+// Writes the 6 vertices of one quad starting at vertices[index].
+void Hud::writeQuad(std::size_t index, sf::Vector2f pen, const GlyphQuad& glyph, sf::Color color) {
+    float left = pen.x + glyph.bounds.position.x, top = pen.y + glyph.bounds.position.y;
+    float right = left + glyph.bounds.size.x, bottom = top + glyph.bounds.size.y;
+    float u0 = glyph.texture.position.x, v0 = glyph.texture.position.y;
+    float u1 = u0 + glyph.texture.size.x, v1 = v0 + glyph.texture.size.y;
+    sf::Vertex* quad = &vertices[index];
+    quad[0] = {{left, top}, color, {u0, v0}};
+    quad[1] = {{right, top}, color, {u1, v0}};
+    quad[2] = {{left, bottom}, color, {u0, v1}};
+    quad[3] = {{left, bottom}, color, {u0, v1}};
+    quad[4] = {{right, top}, color, {u1, v0}};
+    quad[5] = {{right, bottom}, color, {u1, v1}};
+}
+
+// Adds fixed text. Spaces advance the pen without adding a quad.
+void Hud::addLabel(const std::string& text, sf::Vector2f position, sf::Color color) {
+    sf::Vector2f pen = {position.x, position.y + (float)characterSize}; // Baseline, as sf::Text does
+    for (char character : text) {
+        GlyphQuad glyph = makeGlyphQuad((unsigned char)character);
+        if (character != ' ') {
+            vertices.resize(vertices.size() + VERTICES_PER_QUAD);
+            writeQuad(vertices.size() - VERTICES_PER_QUAD, pen, glyph, color);
+        }
+        pen.x += glyph.advance;
+    }
+}
+
+// Adds a prefix label and the digit cells of a counter, initially showing 0.
+std::size_t Hud::addCounter(const std::string& prefix, sf::Vector2f position, unsigned int maxDigits,
+                            sf::Color color) {
+    addLabel(prefix, position, color);
+    float prefixWidth = 0.f;
+    for (char character : prefix) {
+        prefixWidth += font.getGlyph((unsigned char)character, characterSize, false).advance;
+    }
+
+    Counter counter;
+    counter.cells = std::min<unsigned int>(maxDigits + 1, (unsigned int)counter.shown.size());
+    counter.firstVertex = vertices.size();
+    counter.pen = {position.x + prefixWidth, position.y + (float)characterSize};
+    counter.color = color;
+    counter.value = 1; // Anything but 0, so setCounter() below fills the cells in
+    counter.shown.fill(1); // Not a printable character: every cell gets written once
+    vertices.resize(vertices.size() + counter.cells * VERTICES_PER_QUAD);
+    counters.push_back(counter);
+
+    std::size_t id = counters.size() - 1;
+    setCounter(id, 0);
+    return id;
+}
+
+// Sets one digit cell. A blank cell collapses its quad to a point, so it draws nothing.
+void Hud::setCell(Counter& counter, unsigned int cell, char character) {
+    if (counter.shown[cell] == character) return;
+    counter.shown[cell] = character;
+    std::size_t index = counter.firstVertex + cell * VERTICES_PER_QUAD;
+    sf::Vector2f pen = {counter.pen.x + cell * digitAdvance, counter.pen.y};
+    if (character == 0) {
+        for (std::size_t v = 0; v < VERTICES_PER_QUAD; ++v) {
+            vertices[index + v] = {pen, sf::Color::Transparent, {0.f, 0.f}};
+        }
+    } else {
+        const GlyphQuad& glyph = digitGlyphs[character == '-' ? 10 : character - '0'];
+        writeQuad(index, pen, glyph, counter.color);
+    }
+    patchCount++;
+}
+
+// Shows 'value' in counter 'id', patching only the cells whose character changed.
+void Hud::setCounter(std::size_t id, long long value) {
+    Counter& counter = counters[id];
+    if (counter.value == value) return;
+    counter.value = value;
+
+    // Format into a fixed buffer (no std::to_string: that allocates).
+    char text[24];
+    unsigned int length = 0;
+    unsigned int digitCells = counter.cells - 1;
+    unsigned long long magnitude = value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+    char digits[24];
+    unsigned int digitCount = 0;
+    do {
+        digits[digitCount++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0 && digitCount < sizeof(digits));
+    if (digitCount > digitCells) {
+        digitCount = digitCells; // Too wide: saturate to 99...9
+        for (unsigned int i = 0; i < digitCount; ++i) digits[i] = '9';
+    }
+    if (value < 0) text[length++] = '-';
+    while (digitCount > 0) text[length++] = digits[--digitCount];
+
+    for (unsigned int cell = 0; cell < counter.cells; ++cell) {
+        setCell(counter, cell, cell < length ? text[cell] : 0);
+    }
+}
+
+// Draws every label and counter with one draw call.
+void Hud::draw(sf::RenderTarget& target) const {
+    if (vertices.empty()) return;
+    sf::RenderStates states;
+    states.texture = &font.getTexture(characterSize);
+    target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Color.hpp>        // For sf::Color
+#include <SFML/Graphics/Font.hpp>         // For sf::Font and sf::Glyph
+#include <SFML/Graphics/Rect.hpp>         // For sf::FloatRect
+#include <SFML/Graphics/RenderTarget.hpp> // For sf::RenderTarget
+#include <SFML/Graphics/Vertex.hpp>       // For sf::Vertex
+
+// Screen-space text overlay (score, FPS, coins left...) drawn in a single draw call.
+//
+// Unlike sf::Text, nothing is re-laid-out when a value changes. Labels are built once.
+// Counters reserve a fixed number of digit cells, each one textured quad. Every digit
+// advances by the width of the widest digit, so changing a value only rewrites the
+// texture coordinates of the digits that changed. setCounter() with an unchanged value
+// does nothing at all. All vertices live in one array sized when the HUD is set up,
+// so steady-state frames make no heap allocations.
+class Hud {
+public:
+    // Glyphs come from 'font' at 'characterSize'; the font must outlive the HUD.
+    Hud(const sf::Font& font, unsigned int characterSize);
+
+    // --- Setup (may allocate) ---
+    // Adds fixed text at 'position' (top-left, screen pixels).
+    void addLabel(const std::string& text, sf::Vector2f position, sf::Color color = sf::Color::White);
+    // Adds a number of up to 'maxDigits' digits (plus sign) after 'prefix'. Returns its id.
+    std::size_t addCounter(const std::string& prefix, sf::Vector2f position, unsigned int maxDigits,
+                           sf::Color color = sf::Color::White);
+
+    // --- Per Frame (never allocates) ---
+    // Shows 'value' in counter 'id'. Only touches vertices when the value changed;
+    // values wider than the counter show as all 9s.
+    void setCounter(std::size_t id, long long value);
+    // Draws every label and counter with one draw call.
+    void draw(sf::RenderTarget& target) const;
+
+    // Number of vertex patches made so far (each changed digit counts once).
+    std::size_t getPatchCount() const { return patchCount; }
+
+private:
+    // A counter's digit cells: quads [firstVertex / 6, firstVertex / 6 + cells).
+    struct Counter {
+        std::size_t firstVertex = 0;
+        unsigned int cells = 0;          // Sign cell plus maxDigits
+        sf::Vector2f pen;                // Baseline position of the first cell
+        sf::Color color;
+        long long value = 0;
+        std::array<char, 24> shown{};    // Character in each cell (0 for blank)
+    };
+
+    // Pre-fetched glyph of '0'-'9' and '-', with their quads relative to the pen position.
+    struct GlyphQuad {
+        sf::FloatRect bounds;  // Quad relative to the pen (includes padding)
+        sf::FloatRect texture; // Texture rectangle in pixels (includes padding)
+        float advance = 0.f;
+    };
+
+    GlyphQuad makeGlyphQuad(char32_t character) const;
+    // Writes the 6 vertices of one quad starting at vertices[index].
+    void writeQuad(std::size_t index, sf::Vector2f pen, const GlyphQuad& glyph, sf::Color color);
+    // Sets cell 'cell' of 'counter' to 'character' (0 hides it).
+    void setCell(Counter& counter, unsigned int cell, char character);
+
+    const sf::Font& font;
+    unsigned int characterSize;
+    std::array<GlyphQuad, 11> digitGlyphs; // '0'..'9', then '-'
+    float digitAdvance = 0.f;              // Widest digit advance: the counters' cell width
+    std::vector<sf::Vertex> vertices;      // Triangles, 6 per glyph
+    std::vector<Counter> counters;
+    std::size_t patchCount = 0;
+};
@@ -0,0 +1,232 @@
+#include "InputLog.hpp" // Include the header definition for InputLog
+#include <cstring>      // For std::memcpy, std::memcmp
+#include <fstream>      // For std::ifstream, std::ofstream
+#include <iostream>     // For std::cerr
+
+// --- Member Function Implementations ---
+
+// Field-by-field, so padding bytes never take part in the comparison.
+bool SimulationFingerprint::operator==(const SimulationFingerprint& other) const {
+    return tick == other.tick && score == other.score && entityCount == other.entityCount &&
+           positionX == other.positionX && positionY == other.positionY &&
+           velocityX == other.velocityX && velocityY == other.velocityY &&
+           remainingCoins == other.remainingCoins;
+}
+
+// Appends the input of one more tick, extending the last run when the input is unchanged.
+void InputLog::append(const InputState& input) {
+    std::uint8_t mask = toInputMask(input);
+    if (!runs.empty() && runs.back().mask == mask && runs.back().ticks < UINT32_MAX) {
+        runs.back().ticks++;
+    } else {
+        runs.push_back({mask, 1});
+    }
+}
+
+// Total number of ticks recorded.
+std::uint64_t InputLog::getTickCount() const {
+    std::uint64_t total = 0;
+    for (const Run& run : runs) {
+        total += run.ticks;
+    }
+    return total;
+}
+
+// Sets 'input' to the next tick's input. Returns false once the log is exhausted.
+bool InputLogCursor::next(const InputLog& log, InputState& input) {
+    while (run < log.runs.size() && tickInRun >= log.runs[run].ticks) {
+        run++;
+        tickInRun = 0;
+    }
+    if (run >= log.runs.size()) return false;
+    input = fromInputMask(log.runs[run].mask);
+    tickInRun++;
+    return true;
+}
+
+// --- Non-Member Helper Function Implementations ---
+
+std::uint8_t toInputMask(const InputState& input) {
+    return (std::uint8_t)((input.left ? INPUT_LEFT : 0) | (input.right ? INPUT_RIGHT : 0) |
+                          (input.jump ? INPUT_JUMP : 0));
+}
+
+InputState fromInputMask(std::uint8_t mask) {
+    InputState input;
+    input.left = (mask & INPUT_LEFT) != 0;
+    input.right = (mask & INPUT_RIGHT) != 0;
+    input.jump = (mask & INPUT_JUMP) != 0;
+    return input;
+}
+
+namespace {
+
+const std::uint64_t FNV_OFFSET = 14695981039346656037ull;
+const std::uint64_t FNV_PRIME = 1099511628211ull;
+
+std::uint64_t hashBytes(std::uint64_t hash, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+std::uint32_t floatBits(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Unsigned LEB128: 7 bits per byte, high bit set on every byte but the last.
+void writeVarint(std::ostream& out, std::uint32_t value) {
+    while (value >= 0x80) {
+        out.put((char)(value | 0x80));
+        value >>= 7;
+    }
+    out.put((char)value);
+}
+
+bool readVarint(std::istream& in, std::uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = in.get();
+        if (byte == EOF) return false;
+        value |= (std::uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false; // Longer than any 32-bit value
+}
+
+} // namespace
+
+// Hash of the level's size, spawn points and (unless streamed) tiles.
+std::uint64_t computeLevelChecksum(const Level& level) {
+    std::uint64_t hash = FNV_OFFSET;
+    std::uint32_t header[4] = {level.size.x, level.size.y, floatBits(level.spawnPoint.x),
+                               floatBits(level.spawnPoint.y)};
+    hash = hashBytes(hash, header, sizeof(header));
+    // Levels without enemies hash as they did before enemies existed.
+    for (sf::Vector2f spawn : level.enemySpawns) {
+        std::uint32_t position[2] = {floatBits(spawn.x), floatBits(spawn.y)};
+        hash = hashBytes(hash, position, sizeof(position));
+    }
+    if (!level.stream && level.tiles.data) {
+        hash = hashBytes(hash, level.tiles.data, level.tiles.getCellCount());
+    }
+    return hash;
+}
+
+// Captures the state a replay is checked against.
+SimulationFingerprint captureFingerprint(const Simulation& sim) {
+    SimulationFingerprint fingerprint;
+    sf::Vector2f position = sim.player.getPosition(sim.entities);
+    sf::Vector2f velocity = sim.entities.getVelocity(sim.player.entity);
+    fingerprint.tick = sim.tick;
+    fingerprint.score = sim.player.score;
+    fingerprint.entityCount = (std::uint32_t)sim.entities.size();
+    fingerprint.positionX = floatBits(position.x);
+    fingerprint.positionY = floatBits(position.y);
+    fingerprint.velocityX = floatBits(velocity.x);
+    fingerprint.velocityY = floatBits(velocity.y);
+    fingerprint.remainingCoins = sim.level.getRemainingCoins();
+    return fingerprint;
+}
+
+// Writes 'log' as a .dinp file.
+bool saveInputLog(const std::string& path, const InputLog& log) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Error creating input log: " << path << std::endl;
+        return false;
+    }
+
+    InputLogHeader header{};
+    std::memcpy(header.magic, "DINP", 4);
+    header.version = INPUT_LOG_VERSION;
+    header.levelChecksum = log.levelChecksum;
+    header.tickCount = log.getTickCount();
+    header.runCount = (std::uint32_t)log.runs.size();
+    header.hasFingerprint = log.hasFingerprint ? 1 : 0;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const InputLog::Run& run : log.runs) {
+        file.put((char)run.mask);
+        writeVarint(file, run.ticks);
+    }
+    if (log.hasFingerprint) {
+        file.write(reinterpret_cast<const char*>(&log.fingerprint), sizeof(log.fingerprint));
+    }
+    if (!file) {
+        std::cerr << "Error writing input log: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Reads a .dinp file written by saveInputLog().
+bool loadInputLog(const std::string& path, InputLog& log) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Error opening input log: " << path << std::endl;
+        return false;
+    }
+
+    InputLogHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "DINP", 4) != 0) {
+        std::cerr << "Error loading input log: " << path << " is not a .dinp file" << std::endl;
+        return false;
+    }
+    if (header.version != INPUT_LOG_VERSION) {
+        std::cerr << "Error loading input log: " << path << " has version " << header.version
+                  << ", expected " << INPUT_LOG_VERSION << std::endl;
+        return false;
+    }
+
+    log = InputLog();
+    log.levelChecksum = header.levelChecksum;
+    log.runs.reserve(header.runCount);
+    for (std::uint32_t i = 0; i < header.runCount; ++i) {
+        InputLog::Run run;
+        int mask = file.get();
+        if (mask == EOF || !readVarint(file, run.ticks)) {
+            std::cerr << "Error loading input log: " << path << " is truncated" << std::endl;
+            return false;
+        }
+        run.mask = (std::uint8_t)mask;
+        log.runs.push_back(run);
+    }
+    if (log.getTickCount() != header.tickCount) {
+        std::cerr << "Error loading input log: " << path << " is corrupt (tick count mismatch)" << std::endl;
+        return false;
+    }
+    if (header.hasFingerprint) {
+        if (!file.read(reinterpret_cast<char*>(&log.fingerprint), sizeof(log.fingerprint))) {
+            std::cerr << "Error loading input log: " << path << " is truncated" << std::endl;
+            return false;
+        }
+        log.hasFingerprint = true;
+    }
+    return true;
+}
+
+// Converts a log into an InputScript for runInputScript().
+InputScript toInputScript(const InputLog& log, const std::string& name) {
+    InputScript script;
+    script.name = name;
+    script.runs.reserve(log.runs.size());
+    for (const InputLog::Run& run : log.runs) {
+        InputScript::Run scriptRun;
+        scriptRun.input = fromInputMask(run.mask);
+        if (scriptRun.input.jump) {
+            // A script only jumps on the first tick of a run: one run per tick.
+            scriptRun.ticks = 1;
+            for (std::uint32_t i = 0; i < run.ticks; ++i) {
+                script.runs.push_back(scriptRun);
+            }
+        } else {
+            scriptRun.ticks = run.ticks;
+            script.runs.push_back(scriptRun);
+        }
+    }
+    return script;
+}
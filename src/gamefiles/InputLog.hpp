@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Simulation.hpp"  // For InputState and the state being fingerprinted
+#include "InputScript.hpp" // A log can be played back like a script
+
+// --- Recorded Input Format (.dinp) ---
+// A recording of the exact InputState fed to every Simulation::step of a session, so
+// the session can be replayed tick for tick. Each tick's input is a 3-bit mask
+// (INPUT_LEFT | INPUT_RIGHT | INPUT_JUMP) and identical consecutive ticks are stored as
+// one run: a mask byte followed by the run length as a LEB128 varint. A 10-minute
+// session is typically a few KB.
+//
+// File layout (little-endian):
+//     InputLogHeader
+//     runCount x { uint8 mask, varint ticks }
+//     SimulationFingerprint, if header.hasFingerprint
+const std::uint8_t INPUT_LEFT = 1;
+const std::uint8_t INPUT_RIGHT = 2;
+const std::uint8_t INPUT_JUMP = 4;
+
+const std::uint32_t INPUT_LOG_VERSION = 1;
+
+struct InputLogHeader {
+    char magic[4];               // "DINP"
+    std::uint32_t version;       // INPUT_LOG_VERSION
+    std::uint64_t levelChecksum; // computeLevelChecksum() of the level it was recorded on
+    std::uint64_t tickCount;     // Total ticks over all runs
+    std::uint32_t runCount;      // Number of runs that follow
+    std::uint32_t hasFingerprint; // 1 if the final state follows the runs
+};
+
+// The parts of a Simulation that a replay must reproduce exactly. Floats are kept as
+// their bit patterns so "equal" means bit-identical, not just close.
+struct SimulationFingerprint {
+    std::uint64_t tick = 0;
+    std::int32_t score = 0;
+    std::uint32_t entityCount = 0;
+    std::uint32_t positionX = 0, positionY = 0; // Player position (float bits)
+    std::uint32_t velocityX = 0, velocityY = 0; // Player velocity (float bits)
+    std::uint64_t remainingCoins = 0;
+
+    bool operator==(const SimulationFingerprint& other) const;
+    bool operator!=(const SimulationFingerprint& other) const { return !(*this == other); }
+};
+
+// A recorded session: runs of identical per-tick input masks.
+struct InputLog {
+    // One run of identical input.
+    struct Run {
+        std::uint8_t mask = 0;   // INPUT_* bits
+        std::uint32_t ticks = 0; // How many consecutive ticks used it
+    };
+
+    // --- Member Variables ---
+    std::vector<Run> runs;
+    std::uint64_t levelChecksum = 0;
+    bool hasFingerprint = false;
+    SimulationFingerprint fingerprint; // Final state when recording stopped
+
+    // --- Member Functions (Declarations) ---
+    // Appends the input of one more tick.
+    void append(const InputState& input);
+    // Total number of ticks recorded.
+    std::uint64_t getTickCount() const;
+};
+
+// Walks an InputLog one tick at a time, for replaying inside a frame loop.
+struct InputLogCursor {
+    std::size_t run = 0;          // Current run
+    std::uint32_t tickInRun = 0;  // Ticks of the current run already returned
+
+    // Sets 'input' to the next tick's input. Returns false once the log is exhausted.
+    bool next(const InputLog& log, InputState& input);
+};
+
+// --- Non-Member Helper Functions (Declarations) ---
+std::uint8_t toInputMask(const InputState& input);
+InputState fromInputMask(std::uint8_t mask);
+
+// Hash of the level's size, spawn points and tiles (FNV-1a). Streamed levels only hash
+// the size and spawn points, since their tiles are not all in memory.
+std::uint64_t computeLevelChecksum(const Level& level);
+// Captures the state a replay is checked against.
+SimulationFingerprint captureFingerprint(const Simulation& sim);
+
+// Both print the problem to std::cerr and return false on failure.
+bool saveInputLog(const std::string& path, const InputLog& log);
+bool loadInputLog(const std::string& path, InputLog& log);
+
+// Converts a log into an InputScript (named 'name') for runInputScript(). Jump is a
+// per-tick bit in a log but a first-tick-of-run press in a script, so jump runs are split.
+InputScript toInputScript(const InputLog& log, const std::string& name);
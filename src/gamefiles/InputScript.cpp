@@ -0,0 +1,77 @@
+#include "InputScript.hpp" // Include the header definition for InputScript
+#include <fstream>         // For std::ifstream
+#include <iostream>        // For std::cerr
+#include <sstream>         // For std::istringstream
+
+// --- Member Function Implementations ---
+
+// Total number of ticks in the script.
+std::uint64_t InputScript::getTickCount() const {
+    std::uint64_t total = 0;
+    for (const Run& run : runs) {
+        total += run.ticks;
+    }
+    return total;
+}
+
+// --- Non-Member Helper Function Implementations ---
+
+// Loads a text input script. Prints the problem to std::cerr and returns false on failure.
+bool loadInputScript(const std::string& path, InputScript& script) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Error opening input script: " << path << std::endl;
+        return false;
+    }
+
+    script.name = path;
+    script.runs.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream fields(line);
+        long long ticks = 0;
+        std::string keys;
+        if (!(fields >> ticks)) continue; // Blank or comment-only line
+        if (!(fields >> keys) || ticks < 0) {
+            std::cerr << path << ":" << lineNumber << ": expected '<ticks> <keys>'" << std::endl;
+            return false;
+        }
+
+        InputScript::Run run;
+        run.ticks = (std::uint32_t)ticks;
+        for (char key : keys) {
+            switch (key) {
+                case 'L': case 'l': run.input.left = true; break;
+                case 'R': case 'r': run.input.right = true; break;
+                case 'J': case 'j': run.input.jump = true; break;
+                case '-': break;
+                default:
+                    std::cerr << path << ":" << lineNumber << ": unknown key '" << key << "'" << std::endl;
+                    return false;
+            }
+        }
+        script.runs.push_back(run);
+    }
+    return true;
+}
+
+// Plays 'script' through 'sim' from its current state. Returns the number of deaths.
+int runInputScript(Simulation& sim, const InputScript& script) {
+    int deaths = 0;
+    for (const InputScript::Run& run : script.runs) {
+        InputState input = run.input;
+        for (std::uint32_t i = 0; i < run.ticks; ++i) {
+            StepEvents events = sim.step(input);
+            if (events.fellOutOfBounds || events.hitEnemy || events.hitHazard) {
+                deaths++;
+            }
+            input.jump = false; // Jump is a press, not a hold
+        }
+    }
+    return deaths;
+}
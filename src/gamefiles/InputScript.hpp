@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Simulation.hpp" // For InputState
+
+// A scripted sequence of inputs, stored as runs of identical ticks.
+//
+// Text format, one run per line ('#' starts a comment):
+//     <ticks> <keys>
+// where <keys> is any combination of L (left), R (right) and J (jump), or '-' for
+// no keys. J only presses jump on the first tick of its run, like a key press event.
+struct InputScript {
+    // One run of identical input.
+    struct Run {
+        std::uint32_t ticks = 0; // How many ticks the run lasts
+        InputState input;        // Input used for those ticks
+    };
+
+    // --- Member Variables ---
+    std::string name;       // Where the script came from (file name), for reports
+    std::vector<Run> runs;  // Runs in playback order
+
+    // --- Member Functions (Declarations) ---
+    // Total number of ticks in the script.
+    std::uint64_t getTickCount() const;
+};
+
+// --- Non-Member Helper Functions (Declarations) ---
+// Loads a text input script. Prints the problem to std::cerr and returns false on failure.
+bool loadInputScript(const std::string& path, InputScript& script);
+
+// Plays 'script' through 'sim' from its current state. Returns the number of times the
+// player died (fell out of the level or touched an enemy).
+int runInputScript(Simulation& sim, const InputScript& script);
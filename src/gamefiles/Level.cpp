@@ -1,25 +1,135 @@
 #include "Level.hpp"       // Include the header definition for Level
 #include "Constants.hpp"   // Include global constants like TILE_SIZE
+#include <algorithm>       // For std::max
+#include <atomic>          // For the generation counter
+#include <fstream>         // For std::ifstream (loadTextLevel)
+#include <iostream>        // For std::cerr
+#include <utility>         // For std::move
 
 // --- Member Function Implementations ---
 
-// Safely retrieves the tile type at given grid coordinates (x, y).
-TileType Level::getTile(int x, int y) const {
-    // Boundary check
-    if (x >= 0 && x < size.x && y >= 0 && y < size.y) {
-        return tiles[y][x]; // Access is [row][column] or [y][x]
+// Levels are copied and loaded on worker threads (assets, servers), hence the atomic.
+std::uint64_t LevelGeneration::next() {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// Sets the level dimensions and fills every tile with Air.
+void Level::resize(sf::Vector2u newSize) {
+    TileGrid grid;
+    grid.resize(newSize.x, newSize.y, TileType::Air);
+    adoptTiles(std::move(grid));
+}
+
+// Takes over an already filled grid (e.g. a mapped level file) and sizes the level to it.
+void Level::adoptTiles(TileGrid grid) {
+    tiles = std::move(grid);
+    stream.reset();
+    setDimensions({tiles.width, tiles.height});
+}
+
+// Sets the size-derived members and resets the chunk revisions.
+void Level::setDimensions(sf::Vector2u newSize) {
+    generation.value = LevelGeneration::next(); // Revisions restart at 0 and would match the old ones
+    size = newSize;
+    sizePixels = {(float)size.x * TILE_SIZE, (float)size.y * TILE_SIZE};
+    // Round up so partially filled chunks at the right/bottom edges are included.
+    chunkCount = {(size.x + LEVEL_CHUNK_SIZE - 1) / LEVEL_CHUNK_SIZE,
+                  (size.y + LEVEL_CHUNK_SIZE - 1) / LEVEL_CHUNK_SIZE};
+    chunkRevisions.assign(chunkCount.x * chunkCount.y, 0);
+    pickups.reset(chunkCount.x, chunkCount.y);
+    solidity.clear();
+}
+
+// Counts the coins of chunk (cx, cy) into the pickup index, once per chunk.
+// For streamed levels the chunk must be resident.
+static void countChunkPickups(Level& level, int cx, int cy) {
+    std::size_t index = cy * level.chunkCount.x + cx;
+    if (level.pickups.chunkCounted[index]) return;
+    level.pickups.chunkCounted[index] = true;
+    int x0 = cx * LEVEL_CHUNK_SIZE, y0 = cy * LEVEL_CHUNK_SIZE;
+    int x1 = std::min(x0 + LEVEL_CHUNK_SIZE, (int)level.size.x);
+    int y1 = std::min(y0 + LEVEL_CHUNK_SIZE, (int)level.size.y);
+    int coins = 0;
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            coins += hasTileFlag(level.getTile(x, y), TILE_PICKUP);
+        }
     }
-    return TileType::Air; // Out of bounds is treated as Air
+    level.pickups.add(cx, cy, coins);
+}
+
+// Rebuilds the pickup and solidity indexes from the tiles.
+void Level::rebuildTileIndexes() {
+    pickups.reset(chunkCount.x, chunkCount.y);
+    solidity.clear();
+    if (stream) return; // Pickups are counted chunk by chunk as they arrive
+    // One pass over the grid in memory order (a mapped level is only read, never copied)
+    // fills both indexes.
+    solidity.build(tiles, pickups);
+    std::fill(pickups.chunkCounted.begin(), pickups.chunkCounted.end(), true);
 }
 
 // Safely sets the tile type at given grid coordinates (x, y).
 bool Level::setTile(int x, int y, TileType newType) {
-    // Boundary check
-     if (x >= 0 && x < size.x && y >= 0 && y < size.y) {
-        tiles[y][x] = newType;
-        return true; // Indicate success
+    TileType oldType = getTile(x, y);
+    if (stream) {
+        if (!stream->setTile(x, y, newType)) return false;
+    } else if (tiles.inBounds(x, y)) { // Boundary check
+        tiles.at(x, y) = newType;
+    } else {
+        return false; // Indicate failure (out of bounds)
+    }
+    int cx = x / LEVEL_CHUNK_SIZE, cy = y / LEVEL_CHUNK_SIZE;
+    // Mark the containing chunk as changed for renderers and other caches.
+    chunkRevisions[cy * chunkCount.x + cx]++;
+    if (recordTileChanges) {
+        tileChanges.push_back({x, y, newType, oldType});
+    }
+    if (solidity.built) {
+        solidity.update(x, y, newType);
     }
-    return false; // Indicate failure (out of bounds)
+    // Keep the pickup count of the chunk in step with the tile.
+    if (pickups.chunkCounted[cy * chunkCount.x + cx]) {
+        pickups.add(cx, cy, hasTileFlag(newType, TILE_PICKUP) - hasTileFlag(oldType, TILE_PICKUP));
+    }
+    return true; // Indicate success
+}
+
+// Returns the change counter of chunk (cx, cy), or 0 if out of bounds.
+unsigned int Level::getChunkRevision(int cx, int cy) const {
+    if (cx >= 0 && cx < (int)chunkCount.x && cy >= 0 && cy < (int)chunkCount.y) {
+        return chunkRevisions[cy * chunkCount.x + cx];
+    }
+    return 0;
+}
+
+
+// Loads/evicts streamed chunks around the camera. Does nothing for fully loaded levels.
+void Level::streamAround(sf::Vector2f center, sf::Vector2f halfExtent) {
+    if (!stream) return;
+    std::vector<sf::Vector2i> changedChunks;
+    stream->update(center, halfExtent, changedChunks);
+    // Chunks that arrived or were evicted look like edits to renderers and other caches.
+    for (sf::Vector2i chunk : changedChunks) {
+        chunkRevisions[chunk.y * chunkCount.x + chunk.x]++;
+        // Count a chunk's coins the first time it arrives. Evicted chunks are never modified,
+        // so their count stays valid for when they are loaded again.
+        if (stream->isLoaded(chunk.x * LEVEL_CHUNK_SIZE, chunk.y * LEVEL_CHUNK_SIZE)) {
+            countChunkPickups(*this, chunk.x, chunk.y);
+        }
+    }
+}
+
+// Are the tiles around 'position' (pixels) available? Always true unless streamed.
+bool Level::isLoadedAt(sf::Vector2f position) const {
+    if (!stream) return true;
+    int x = static_cast<int>(position.x / TILE_SIZE);
+    int y = static_cast<int>(position.y / TILE_SIZE);
+    if (x < 0 || y < 0 || x >= (int)size.x || y >= (int)size.y) {
+        return true; // Outside the level there is nothing to load
+    }
+    return stream->isLoaded(x, y);
 }
 
 
@@ -28,38 +138,102 @@ bool Level::setTile(int x, int y, TileType newType) {
 // Creates a simple, hardcoded level map for demonstration.
 Level createSimpleLevel() {
     Level level;
-    // Set level dimensions in tiles.
-    level.size = {40, 15};
-    // Calculate and store the total level size in pixels.
-    level.sizePixels = {(float)level.size.x * TILE_SIZE, (float)level.size.y * TILE_SIZE};
-    // Allocate the 2D vector for the tile data, initializing all to Air.
-    level.tiles.resize(level.size.y, std::vector<TileType>(level.size.x, TileType::Air));
+    // Set level dimensions in tiles and allocate the tile data, initializing all to Air.
+    level.resize({40, 15});
+    // Player starts just above the floor, next to the left wall.
+    level.spawnPoint = {TILE_SIZE * 1.5f, TILE_SIZE * (level.size.y - 3.f)};
 
     // --- Define Solid Tiles ---
     // Floor
     for (int x = 0; x < level.size.x; ++x) {
-        level.tiles[level.size.y - 1][x] = TileType::Solid;
+        level.tiles.at(x, level.size.y - 1) = TileType::Solid;
     }
     // Platforms
-    for (int x = 5; x < 10; ++x) level.tiles[10][x] = TileType::Solid;
-    for (int x = 12; x < 16; ++x) level.tiles[8][x] = TileType::Solid;
-    level.tiles[6][15] = TileType::Solid;
-    level.tiles[6][16] = TileType::Solid;
-    for (int x = 25; x < 30; ++x) level.tiles[10][x] = TileType::Solid;
-    for (int x = 32; x < 36; ++x) level.tiles[7][x] = TileType::Solid;
-    level.tiles[12][21] = TileType::Solid;
-    level.tiles[12][22] = TileType::Solid;
+    for (int x = 5; x < 10; ++x) level.tiles.at(x, 10) = TileType::Solid;
+    for (int x = 12; x < 16; ++x) level.tiles.at(x, 8) = TileType::Solid;
+    level.tiles.at(15, 6) = TileType::Solid;
+    level.tiles.at(16, 6) = TileType::Solid;
+    for (int x = 25; x < 30; ++x) level.tiles.at(x, 10) = TileType::Solid;
+    for (int x = 32; x < 36; ++x) level.tiles.at(x, 7) = TileType::Solid;
+    level.tiles.at(21, 12) = TileType::Solid;
+    level.tiles.at(22, 12) = TileType::Solid;
     // Walls
-    for (int y = 11; y < level.size.y -1; ++y) level.tiles[y][2] = TileType::Solid;
-    for (int y = 6; y < 11; ++y) level.tiles[y][18] = TileType::Solid;
-    for (int y = 8; y < level.size.y -1; ++y) level.tiles[y][38] = TileType::Solid;
+    for (int y = 11; y < level.size.y -1; ++y) level.tiles.at(2, y) = TileType::Solid;
+    for (int y = 6; y < 11; ++y) level.tiles.at(18, y) = TileType::Solid;
+    for (int y = 8; y < level.size.y -1; ++y) level.tiles.at(38, y) = TileType::Solid;
 
     // --- Define Coin Tiles ---
-    level.tiles[9][7] = TileType::Coin;
-    level.tiles[7][14] = TileType::Coin;
-    level.tiles[9][27] = TileType::Coin;
-    level.tiles[6][34] = TileType::Coin;
-    level.tiles[11][21] = TileType::Coin;
+    level.tiles.at(7, 9) = TileType::Coin;
+    level.tiles.at(14, 7) = TileType::Coin;
+    level.tiles.at(27, 9) = TileType::Coin;
+    level.tiles.at(34, 6) = TileType::Coin;
+    level.tiles.at(21, 11) = TileType::Coin;
 
+    // --- Define Enemies ---
+    // One guarding the floor, one on the high platform to the right.
+    level.enemySpawns.push_back({TILE_SIZE * 24.5f, TILE_SIZE * 13.5f});
+    level.enemySpawns.push_back({TILE_SIZE * 33.5f, TILE_SIZE * 6.5f});
+
+    level.rebuildTileIndexes();
     return level; // Return the fully defined level structure.
 }
+
+// Loads a level from an ASCII map, one text row per tile row.
+bool loadTextLevel(const std::string& path, Level& level) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Error opening level: " << path << std::endl;
+        return false;
+    }
+
+    // Read all rows first; the widest row decides the level width.
+    std::vector<std::string> rows;
+    std::string line;
+    std::size_t width = 0;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back(); // Tolerate CRLF files
+        width = std::max(width, line.size());
+        rows.push_back(line);
+    }
+    if (rows.empty() || width == 0) {
+        std::cerr << "Error loading level: " << path << " is empty" << std::endl;
+        return false;
+    }
+
+    level.resize({(unsigned int)width, (unsigned int)rows.size()});
+    // Same default spawn as createSimpleLevel() if the map has no 'P'.
+    level.spawnPoint = {TILE_SIZE * 1.5f, TILE_SIZE * (level.size.y - 3.f)};
+    level.enemySpawns.clear();
+    for (int y = 0; y < (int)rows.size(); ++y) {
+        for (int x = 0; x < (int)rows[y].size(); ++x) {
+            char symbol = rows[y][x];
+            TileType type = TileType::Air;
+            if (symbol == 'P') {
+                level.spawnPoint = {(x + 0.5f) * TILE_SIZE, (y + 0.5f) * TILE_SIZE};
+            } else if (symbol == 'E') {
+                level.enemySpawns.push_back({(x + 0.5f) * TILE_SIZE, (y + 0.5f) * TILE_SIZE});
+            } else if (symbol == ' ' || findTileBySymbol(symbol, type)) {
+                level.tiles.at(x, y) = type;
+            } else {
+                std::cerr << path << ":" << (y + 1) << ": unknown tile '" << symbol << "'" << std::endl;
+                return false;
+            }
+        }
+    }
+    level.rebuildTileIndexes();
+    return true;
+}
+
+// Opens a .dlvl file for chunk streaming.
+bool openStreamedLevel(const std::string& path, std::size_t maxResidentChunks, Level& level) {
+    auto stream = std::make_shared<LevelStream>();
+    if (!stream->open(path, maxResidentChunks)) {
+        return false;
+    }
+    level.tiles = TileGrid(); // Tiles come from the stream instead
+    level.setDimensions(stream->getSize());
+    level.spawnPoint = stream->getSpawnPoint();
+    level.enemySpawns = stream->getEnemySpawns();
+    level.stream = std::move(stream);
+    return true;
+}
@@ -1,29 +1,153 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 #include <SFML/System/Vector2.hpp> // Required for sf::Vector2u and sf::Vector2f
+#include "TileGrid.hpp"            // TileType and the flat tile storage
+#include "TileProperties.hpp"      // What each tile type does
+#include "LevelStream.hpp"         // Chunk streaming for levels larger than memory
+#include "PickupIndex.hpp"         // Per-chunk coin counts
+#include "SolidityIndex.hpp"       // Bitsets of blocking tiles
 
-// Defines symbolic names for different types of tiles in the level grid.
-enum class TileType { // Use 'enum class' for stronger type safety
-    Air = 0,
-    Solid = 1,
-    Coin = 2
+// One Level::setTile call, as recorded in Level::tileChanges.
+struct TileChange {
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    TileType type = TileType::Air;     // The new tile
+    TileType previous = TileType::Air; // The tile it replaced (for undo)
+};
+
+// Identifies one layout of a level for caches keyed on it (e.g. TileMapRenderer). Every
+// instance gets a number never handed out before, and so does every copy and assignment,
+// so a level loaded into the same Level object as the last one still reads as new.
+struct LevelGeneration {
+    std::uint64_t value = next();
+
+    LevelGeneration() = default;
+    LevelGeneration(const LevelGeneration&) {}
+    LevelGeneration& operator=(const LevelGeneration&) {
+        value = next();
+        return *this;
+    }
+    // A fresh generation number (thread-safe; 0 is never returned).
+    static std::uint64_t next();
 };
 
 // Structure to hold all data related to a game level.
 struct Level {
     // --- Member Variables ---
-    std::vector<std::vector<TileType>> tiles; // 2D grid holding the tile types
+    TileGrid tiles;                           // Flat grid holding the tile types (1 byte each)
     sf::Vector2u size;                        // Dimensions of the level in tiles (width, height)
     sf::Vector2f sizePixels;                  // Dimensions of the level in pixels
+    sf::Vector2f spawnPoint;                  // Where the player starts and respawns (pixels)
+    std::vector<sf::Vector2f> enemySpawns;    // Where enemies start (pixels)
+    sf::Vector2u chunkCount;                  // Dimensions of the level in chunks (LEVEL_CHUNK_SIZE tiles each)
+    std::vector<unsigned int> chunkRevisions; // Bumped by setTile so caches know which chunks changed
+    LevelGeneration generation;               // Renewed by setDimensions (so by resize, adoptTiles
+                                              // and streaming) and by copies/assignment; chunk
+                                              // revisions only compare within one generation
+    std::shared_ptr<LevelStream> stream;      // Set for streamed levels; 'tiles' is then unused.
+                                              // Copies of a streamed level share (and modify) one stream.
+    PickupIndex pickups;                      // Pickup tiles per chunk, kept up to date by setTile
+    SolidityIndex solidity;                   // Blocking tiles as row/column bitsets, kept up to
+                                              // date by setTile (empty for streamed levels)
+    bool recordTileChanges = false;           // Should setTile append to tileChanges?
+    std::vector<TileChange> tileChanges;      // Successful setTile calls, oldest first, until
+                                              // the owner clears it (e.g. to mirror the level)
 
     // --- Member Functions (Declarations) ---
+    // Sets the level dimensions and fills every tile with Air.
+    void resize(sf::Vector2u newSize);
+    // Takes over an already filled grid (e.g. a mapped level file) and sizes the level to it.
+    void adoptTiles(TileGrid grid);
+    // Sets size, sizePixels and chunkCount, starts a new generation, and resets every chunk
+    // revision and the tile indexes. Leaves tiles alone.
+    void setDimensions(sf::Vector2u newSize);
+    // Rebuilds the pickup and solidity indexes from the tiles. Loaders call this once the
+    // tiles are filled in; streamed levels count each chunk's pickups when it first arrives
+    // instead, and have no solidity index.
+    void rebuildTileIndexes();
     // Safely retrieves the tile type at given grid coordinates (x, y).
-    TileType getTile(int x, int y) const;
+    // Defined inline because collision, coin collection and rendering all call it per tile.
+    TileType getTile(int x, int y) const { return stream ? stream->getTile(x, y) : tiles.get(x, y); }
     // Safely sets the tile type at given grid coordinates (x, y).
     bool setTile(int x, int y, TileType newType);
+    // Returns the change counter of chunk (cx, cy), or 0 if out of bounds.
+    unsigned int getChunkRevision(int cx, int cy) const;
+    // For streamed levels: loads/evicts chunks around the camera ('center' +- 'halfExtent',
+    // in pixels) without blocking. Does nothing for fully loaded levels.
+    void streamAround(sf::Vector2f center, sf::Vector2f halfExtent);
+    // Are the tiles around 'position' (pixels) available? Always true unless streamed.
+    bool isLoadedAt(sf::Vector2f position) const;
+    // Number of pickup tiles (coins, gems) left in the level (streamed levels: in the chunks
+    // seen so far). O(1).
+    std::size_t getRemainingCoins() const { return pickups.remaining; }
 };
 
+// --- Tile Queries ---
+// Does any tile in columns x0..x1 and rows y0..y1 (inclusive) have a flag in Mask?
+// Mask is a template argument, so every caller gets its own loop whose per-tile test is a
+// table load and one AND with a constant, however many tile types there are. Masks of
+// only TILE_SOLID / TILE_ONE_WAY are answered from the solidity index, 64 tiles at a time.
+template <std::uint8_t Mask>
+bool anyTileHas(const Level& level, int x0, int y0, int x1, int y1) {
+    if constexpr ((Mask & ~(TILE_SOLID | TILE_ONE_WAY)) == 0) {
+        if (level.solidity.built) return level.solidity.anyInArea(x0, y0, x1, y1, Mask);
+    }
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            if (getTileFlags(level.getTile(x, y)) & Mask) return true;
+        }
+    }
+    return false;
+}
+
+// Column of the first tile with a flag in Mask in row 'y', scanning from 'fromX' towards
+// 'toX' (inclusive, either direction), or -1 if there is none. One bit scan per 64 tiles
+// when the solidity index can answer it.
+template <std::uint8_t Mask>
+int findTileInRow(const Level& level, int y, int fromX, int toX) {
+    if constexpr ((Mask & ~(TILE_SOLID | TILE_ONE_WAY)) == 0) {
+        if (level.solidity.built) return level.solidity.findInRow(y, fromX, toX, Mask);
+    }
+    int step = fromX <= toX ? 1 : -1;
+    for (int x = fromX; x != toX + step; x += step) {
+        if (getTileFlags(level.getTile(x, y)) & Mask) return x;
+    }
+    return -1;
+}
+
+// Row of the first tile with a flag in Mask in column 'x', scanning from 'fromY' towards
+// 'toY' (inclusive, either direction), or -1 if there is none.
+template <std::uint8_t Mask>
+int findTileInColumn(const Level& level, int x, int fromY, int toY) {
+    if constexpr ((Mask & ~(TILE_SOLID | TILE_ONE_WAY)) == 0) {
+        if (level.solidity.built) return level.solidity.findInColumn(x, fromY, toY, Mask);
+    }
+    int step = fromY <= toY ? 1 : -1;
+    for (int y = fromY; y != toY + step; y += step) {
+        if (getTileFlags(level.getTile(x, y)) & Mask) return y;
+    }
+    return -1;
+}
+
+// Is no tile in columns x0..x1, rows y0..y1 (inclusive) solid? E.g. "can a body fit here".
+inline bool isAreaFree(const Level& level, int x0, int y0, int x1, int y1) {
+    return !anyTileHas<TILE_SOLID>(level, x0, y0, x1, y1);
+}
+
 // --- Non-Member Helper Function (Declaration) ---
 // Creates a simple, hardcoded level map for demonstration.
 Level createSimpleLevel();
+
+// Loads a level from an ASCII map, one text row per tile row:
+//     each tile type's TileProperties::symbol ('#' = Solid, 'o' = Coin, '^' = Spikes,
+//     '=' = Platform, '*' = Gem, '.' or ' ' = Air), 'P' = player spawn and 'E' = enemy.
+// Prints the problem to std::cerr and returns false on failure.
+bool loadTextLevel(const std::string& path, Level& level);
+
+// Opens a .dlvl file for chunk streaming, keeping at most 'maxResidentChunks' unmodified
+// chunks in memory. Prints the problem to std::cerr and returns false on failure.
+bool openStreamedLevel(const std::string& path, std::size_t maxResidentChunks, Level& level);
@@ -0,0 +1,176 @@
+#include "LevelFile.hpp"  // Include the header definition for the level file format
+#include "Constants.hpp"  // Include global constants like TILE_SIZE
+#include "MappedFile.hpp" // For mapping .dlvl files
+#include <algorithm>      // For std::max
+#include <cstdlib>        // For std::atoi
+#include <cstring>        // For std::memcpy, std::memcmp, std::strlen
+#include <fstream>        // For std::ifstream, std::ofstream
+#include <iostream>       // For std::cerr
+#include <memory>         // For std::make_shared
+#include <sstream>        // For std::istringstream
+#include <vector>         // For CSV rows
+
+static_assert(sizeof(LevelFileHeader) == 40, "LevelFileHeader layout is part of the file format");
+static_assert(sizeof(TileType) == 1, "The .dlvl payload stores one byte per tile");
+
+// --- Non-Member Helper Function Implementations ---
+
+// Decodes the spawn section; each spawn point is two little-endian floats.
+bool readLevelSpawns(const LevelFileHeader& header, const void* section, std::uint64_t size,
+                     std::vector<sf::Vector2f>& spawns) {
+    const std::uint64_t bytes = (std::uint64_t)header.spawnCount * sizeof(float) * 2;
+    if (bytes > size) {
+        std::cerr << "Error loading level: " << header.spawnCount << " enemy spawns do not fit before the tiles"
+                  << std::endl;
+        return false;
+    }
+    spawns.resize(header.spawnCount);
+    for (std::size_t i = 0; i < spawns.size(); ++i) {
+        float point[2];
+        std::memcpy(point, static_cast<const char*>(section) + i * sizeof(point), sizeof(point));
+        spawns[i] = {point[0], point[1]};
+    }
+    return true;
+}
+
+// Maps a .dlvl file and uses its payload directly as the level's tiles.
+bool loadBinaryLevel(const std::string& path, Level& level) {
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(path)) {
+        return false;
+    }
+
+    LevelFileHeader header;
+    if (file->getSize() < sizeof(header)) {
+        std::cerr << "Error loading level: " << path << " is too small for a header" << std::endl;
+        return false;
+    }
+    std::memcpy(&header, file->getData(), sizeof(header));
+    if (std::memcmp(header.magic, "DLVL", 4) != 0 || header.version != LEVEL_FILE_VERSION) {
+        std::cerr << "Error loading level: " << path << " is not a version " << LEVEL_FILE_VERSION
+                  << " .dlvl file" << std::endl;
+        return false;
+    }
+    if (header.tileSize != (std::uint32_t)TILE_SIZE) {
+        std::cerr << "Error loading level: " << path << " uses " << header.tileSize
+                  << " px tiles, the game uses " << TILE_SIZE << std::endl;
+        return false;
+    }
+    std::uint64_t payloadSize = (std::uint64_t)header.width * header.height;
+    if (header.payloadOffset < sizeof(header) || header.payloadOffset > file->getSize() ||
+        file->getSize() - header.payloadOffset < payloadSize) {
+        std::cerr << "Error loading level: " << path << " is truncated" << std::endl;
+        return false;
+    }
+    std::vector<sf::Vector2f> enemySpawns;
+    if (!readLevelSpawns(header, file->getData() + sizeof(header), header.payloadOffset - sizeof(header),
+                         enemySpawns)) {
+        return false;
+    }
+
+    // No copy and no parse: the mapped payload becomes the tile storage.
+    TileType* tiles = reinterpret_cast<TileType*>(file->getData() + header.payloadOffset);
+    TileGrid grid;
+    grid.adopt(std::move(file), tiles, header.width, header.height);
+    level.adoptTiles(std::move(grid));
+    level.spawnPoint = {header.spawnX, header.spawnY};
+    level.enemySpawns = std::move(enemySpawns);
+    // A single sequential read of the mapping builds the solidity index and counts the
+    // pickups together; it is the only full pass made at load.
+    level.rebuildTileIndexes();
+    return true;
+}
+
+// Writes 'level' as a .dlvl file.
+bool saveBinaryLevel(const std::string& path, const Level& level) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Error creating level file: " << path << std::endl;
+        return false;
+    }
+
+    LevelFileHeader header{};
+    std::memcpy(header.magic, "DLVL", 4);
+    header.version = LEVEL_FILE_VERSION;
+    header.width = level.size.x;
+    header.height = level.size.y;
+    header.tileSize = TILE_SIZE;
+    header.spawnX = level.spawnPoint.x;
+    header.spawnY = level.spawnPoint.y;
+    header.spawnCount = (std::uint32_t)level.enemySpawns.size();
+    // Round the header and spawns up to the payload alignment; the gap is zero padding.
+    std::vector<float> spawns;
+    for (sf::Vector2f spawn : level.enemySpawns) {
+        spawns.push_back(spawn.x);
+        spawns.push_back(spawn.y);
+    }
+    const std::uint64_t headerBytes = sizeof(header) + spawns.size() * sizeof(float);
+    header.payloadOffset = (headerBytes + LEVEL_FILE_PAYLOAD_ALIGNMENT - 1) / LEVEL_FILE_PAYLOAD_ALIGNMENT *
+                           LEVEL_FILE_PAYLOAD_ALIGNMENT;
+
+    char padding[LEVEL_FILE_PAYLOAD_ALIGNMENT] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(spawns.data()), (std::streamsize)(spawns.size() * sizeof(float)));
+    file.write(padding, (std::streamsize)(header.payloadOffset - headerBytes));
+    file.write(reinterpret_cast<const char*>(level.tiles.data), (std::streamsize)level.tiles.getCellCount());
+    if (!file) {
+        std::cerr << "Error writing level file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Loads a CSV map: one row per line, comma-separated TileType ids (see the TileProperties
+// table for what each does).
+bool loadCsvLevel(const std::string& path, Level& level) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Error opening level: " << path << std::endl;
+        return false;
+    }
+
+    std::vector<std::vector<TileType>> rows;
+    std::size_t width = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line == "\r") continue;
+        std::vector<TileType> row;
+        std::istringstream cells(line);
+        std::string cell;
+        while (std::getline(cells, cell, ',')) {
+            int id = std::atoi(cell.c_str());
+            if (id < 0 || id >= (int)TileType::Count) {
+                std::cerr << path << ":" << (rows.size() + 1) << ": unknown tile id " << id << std::endl;
+                return false;
+            }
+            row.push_back((TileType)id);
+        }
+        width = std::max(width, row.size());
+        rows.push_back(std::move(row));
+    }
+    if (rows.empty() || width == 0) {
+        std::cerr << "Error loading level: " << path << " is empty" << std::endl;
+        return false;
+    }
+
+    level.resize({(unsigned int)width, (unsigned int)rows.size()});
+    level.spawnPoint = {TILE_SIZE * 1.5f, TILE_SIZE * (level.size.y - 3.f)};
+    for (int y = 0; y < (int)rows.size(); ++y) {
+        for (int x = 0; x < (int)rows[y].size(); ++x) {
+            level.tiles.at(x, y) = rows[y][x];
+        }
+    }
+    level.rebuildTileIndexes();
+    return true;
+}
+
+// Picks the loader from the file extension: .dlvl (binary), .csv, anything else is ASCII.
+bool loadLevel(const std::string& path, Level& level) {
+    auto endsWith = [&path](const char* suffix) {
+        std::size_t length = std::strlen(suffix);
+        return path.size() >= length && path.compare(path.size() - length, length, suffix) == 0;
+    };
+    if (endsWith(".dlvl")) return loadBinaryLevel(path, level);
+    if (endsWith(".csv")) return loadCsvLevel(path, level);
+    return loadTextLevel(path, level);
+}
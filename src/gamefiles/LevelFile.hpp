@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Level.hpp" // Level is filled in / written out
+
+// --- Binary Level Format (.dlvl) ---
+// A fixed little-endian header, the enemy spawn points (spawnCount pairs of floats, x then
+// y in pixels, right after the header) and the raw tile payload: width * height bytes,
+// row-major, one TileType per byte. The payload is exactly the in-memory layout of
+// TileGrid, so loadBinaryLevel() maps the file and uses it as the level's tile storage
+// without parsing; startup cost is the page faults for the tiles actually touched.
+struct LevelFileHeader {
+    char magic[4];              // "DLVL"
+    std::uint32_t version;      // LEVEL_FILE_VERSION
+    std::uint32_t width;        // Level width in tiles
+    std::uint32_t height;       // Level height in tiles
+    std::uint32_t tileSize;     // Tile size in pixels the map was authored for
+    float spawnX;               // Player spawn point (pixels)
+    float spawnY;
+    std::uint32_t spawnCount;   // Enemy spawn points following the header
+    std::uint64_t payloadOffset; // Byte offset of the first tile from the start of the file
+};
+
+const std::uint32_t LEVEL_FILE_VERSION = 2; // 2: enemy spawns (replaced a reserved field)
+const std::uint64_t LEVEL_FILE_PAYLOAD_ALIGNMENT = 64; // Tiles start on a cache line
+
+// --- Non-Member Helper Functions (Declarations) ---
+// All of these print the problem to std::cerr and return false on failure.
+
+// Decodes the enemy spawn points of a .dlvl file from its spawn section, the 'size' bytes
+// at 'section' that follow the header. Fails if they hold fewer than header.spawnCount.
+bool readLevelSpawns(const LevelFileHeader& header, const void* section, std::uint64_t size,
+                     std::vector<sf::Vector2f>& spawns);
+// Maps a .dlvl file and uses its payload directly as the level's tiles.
+bool loadBinaryLevel(const std::string& path, Level& level);
+// Writes 'level' as a .dlvl file.
+bool saveBinaryLevel(const std::string& path, const Level& level);
+// Loads a CSV map: one row per line, comma-separated TileType ids (see the TileProperties
+// table for what each does).
+bool loadCsvLevel(const std::string& path, Level& level);
+// Picks the loader from the file extension: .dlvl (binary), .csv, anything else is ASCII.
+bool loadLevel(const std::string& path, Level& level);
@@ -0,0 +1,268 @@
+#include "LevelGenerator.hpp" // Include the header definition for the generator
+#include "Constants.hpp"      // Jump physics, TILE_SIZE
+#include "ThreadPool.hpp"     // Bands are generated in parallel
+#include <algorithm>          // For std::min, std::max, std::clamp
+#include <cstdio>             // For std::sscanf
+#include <iostream>           // For std::cerr
+#include <vector>             // For the span and column lists
+
+namespace {
+
+const int BAND_WIDTH = 256;  // Columns per task. Fixed, so the output does not depend on the threads
+const int MIN_SPAN = 3;      // Ground spans (stretches at one height) are 3 to 10 tiles wide
+const int MAX_SPAN = 10;
+const int MIN_PLATFORM = 3;  // Floating platforms are 3 to 6 tiles wide
+const int MAX_PLATFORM = 6;
+const int MAX_BRANCH = 5;    // Platforms in a side branch off a staircase
+const int TOP_MARGIN = 3;    // Rows kept free at the top of the level
+const int MAX_GROUND_RANGE = 16; // Rows the ground surface can move up and down in
+const std::uint64_t MAX_TILES = 100000000; // levelgen_bench's largest map, 100000 x 1000
+const unsigned int MAX_SIDE = 100000;      // On either axis
+
+// Salts that keep the random streams of bands and band boundaries apart.
+const std::uint64_t BAND_STREAM = 0x62616e64;     // "band"
+const std::uint64_t BOUNDARY_STREAM = 0x65646765; // "edge"
+
+// What one jump can get over, in whole tiles with some margin, from the physics constants.
+struct JumpReach {
+    int rise;    // Highest ledge (or one-way platform above) that can be jumped onto
+    int gap;     // Widest gap that can be cleared...
+    int gapRise; // ... while also rising or falling up to this many tiles
+};
+
+JumpReach computeJumpReach() {
+    float apex = PLAYER_JUMP_VELOCITY * PLAYER_JUMP_VELOCITY / (2.f * GRAVITY); // Pixels above take-off
+    float airTicks = 2.f * -PLAYER_JUMP_VELOCITY / GRAVITY;                       // Until back at take-off height
+    JumpReach reach;
+    reach.rise = std::max(1, (int)(apex / TILE_SIZE) - 1);
+    reach.gapRise = reach.rise / 2;
+    // Two tiles short of the flat jump: covers the player's width and the shorter jump
+    // when landing up to 'gapRise' higher.
+    reach.gap = std::max(1, (int)(airTicks * PLAYER_MOVE_SPEED / TILE_SIZE) - 2);
+    return reach;
+}
+
+// SplitMix64: a small, fast generator that gives the same numbers on every platform
+// (unlike the std:: distributions), seeded per band so bands are independent.
+std::uint64_t mix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct GenRandom {
+    std::uint64_t state;
+
+    GenRandom(std::uint64_t seed, std::uint64_t stream, std::uint64_t index)
+        : state(mix(seed ^ mix(stream ^ mix(index)))) {}
+
+    std::uint64_t next() {
+        state += 0x9e3779b97f4a7c15ULL;
+        return mix(state);
+    }
+    // Uniform in [low, high].
+    int range(int low, int high) { return low + (int)(next() % (std::uint64_t)(high - low + 1)); }
+    bool chance(unsigned int percent) { return next() % 100 < percent; }
+};
+
+// Rows the ground surface (its top tile) may be on; smaller rows are higher.
+struct GroundRange {
+    int top;
+    int bottom;
+};
+
+// Surface row where band 'boundary' - 1 ends and band 'boundary' starts.
+int getBoundaryRow(std::uint64_t seed, int boundary, GroundRange ground) {
+    return GenRandom(seed, BOUNDARY_STREAM, (std::uint64_t)boundary).range(ground.top, ground.bottom);
+}
+
+// A stretch of ground at one height, columns [x0, x1).
+struct Span {
+    int x0, x1;
+    int row;       // Surface row
+    int gapBefore; // Empty columns before it (a pit)
+};
+
+// Generates columns [band * BAND_WIDTH, ...) of 'level'. Writes no other columns.
+void generateBand(const LevelGenParams& params, const JumpReach& reach, GroundRange ground, int band, Level& level) {
+    const int width = (int)params.size.x, height = (int)params.size.y;
+    const int x0 = band * BAND_WIDTH, x1 = std::min(width, x0 + BAND_WIDTH);
+    const bool lastBand = x1 == width;
+    GenRandom rng(params.seed, BAND_STREAM, (std::uint64_t)band);
+
+    // --- Ground Spans ---
+    std::vector<Span> spans;
+    for (int x = x0; x < x1;) {
+        int gap = !spans.empty() && rng.chance(25) ? rng.range(1, reach.gap) : 0;
+        if (!spans.empty() && x + gap + MIN_SPAN > x1) { // No room for a pit and a span: widen the last one
+            spans.back().x1 = x1;
+            break;
+        }
+        int end = std::min(x1, x + gap + rng.range(MIN_SPAN, MAX_SPAN));
+        if (x1 - end < MIN_SPAN) end = x1; // Never leave a sliver behind
+        spans.push_back({x + gap, end, 0, gap});
+        x = end;
+    }
+
+    // Heights: a random walk from the entry row that always stays close enough to the
+    // exit row (where the next band starts) to get there in the spans that are left.
+    auto stepLimit = [&](std::size_t i) { return spans[i].gapBefore > 0 ? reach.gapRise : reach.rise; };
+    std::vector<int> reachToExit(spans.size()); // Largest total climb possible after span i
+    int exitRow = lastBand ? 0 : getBoundaryRow(params.seed, band + 1, ground);
+    int toExit = lastBand ? height : reach.rise; // The last band has no exit to reach
+    for (std::size_t i = spans.size(); i-- > 0;) {
+        reachToExit[i] = toExit;
+        toExit += stepLimit(i);
+    }
+    spans[0].row = getBoundaryRow(params.seed, band, ground);
+    for (std::size_t i = 1; i < spans.size(); ++i) {
+        int limit = stepLimit(i);
+        int low = std::max({spans[i - 1].row - limit, exitRow - reachToExit[i], ground.top});
+        int high = std::min({spans[i - 1].row + limit, exitRow + reachToExit[i], ground.bottom});
+        spans[i].row = rng.range(low, std::max(low, high));
+    }
+
+    // --- Fill the Ground ---
+    // topRow[x - x0]: the highest solid tile of column x (walls included), or 'height' for pits.
+    std::vector<int> topRow(x1 - x0, height);
+    std::vector<int> groundRow(x1 - x0, height); // Same without walls
+    int highestRow = height;
+    for (const Span& span : spans) {
+        for (int x = span.x0; x < span.x1; ++x) groundRow[x - x0] = topRow[x - x0] = span.row;
+        highestRow = std::min(highestRow, span.row);
+        // A low wall to hop over, away from the span's edges.
+        if (span.x1 - span.x0 >= 6 && reach.rise > 1 && rng.chance(20)) {
+            int wallX = rng.range(span.x0 + 2, span.x1 - 3);
+            topRow[wallX - x0] = span.row - rng.range(1, reach.rise - 1);
+            highestRow = std::min(highestRow, topRow[wallX - x0]);
+        }
+    }
+    // Row by row, so each write continues the last one instead of striding down a column.
+    for (int y = highestRow; y < height; ++y) {
+        TileType* row = &level.tiles.at(x0, y);
+        for (int x = x0; x < x1; ++x) {
+            if (y >= topRow[x - x0]) row[x - x0] = TileType::Solid;
+        }
+    }
+    for (int x = x0; x < x1; ++x) {
+        if (groundRow[x - x0] == height) {
+            level.tiles.at(x, height - 1) = TileType::Spikes; // Bottom of a pit
+        } else if (rng.chance(params.coinPercent)) {
+            level.tiles.at(x, topRow[x - x0] - 1) = TileType::Coin;
+        }
+    }
+
+    // --- Floating Platforms ---
+    // Places a one-way platform at columns [px, px + w) of 'row' if it lies inside the band
+    // and clear of the ground and walls (one row of air in between). Returns false if not.
+    auto placePlatform = [&](int px, int w, int row) {
+        if (row < TOP_MARGIN || px < x0 || px + w > x1) return false;
+        for (int x = px; x < px + w; ++x) {
+            if (row > topRow[x - x0] - 2) return false;
+        }
+        for (int x = px; x < px + w; ++x) {
+            if (level.tiles.get(x, row) != TileType::Air) continue; // Crossing another platform
+            level.tiles.at(x, row) = TileType::Platform;
+            if (level.tiles.get(x, row - 1) == TileType::Air && rng.chance(params.coinPercent)) {
+                level.tiles.at(x, row - 1) = TileType::Coin;
+            }
+        }
+        return true;
+    };
+
+    // Staircases: each platform is 'rise' rows above the last and overlaps it by at least
+    // a column, so the player can jump straight up through it (it is one-way) and climb on.
+    // Taller levels get more of them.
+    int staircases = rng.range(0, 1 + height / 64);
+    for (int s = 0; s < staircases; ++s) {
+        const Span& base = spans[rng.range(0, (int)spans.size() - 1)];
+        int px = base.x0, w = base.x1 - base.x0, row = base.row;
+        int topLimit = rng.range(TOP_MARGIN, std::max(TOP_MARGIN, row - reach.rise));
+        while (row - reach.rise >= topLimit) {
+            int nextW = rng.range(MIN_PLATFORM, MAX_PLATFORM);
+            int lowX = std::max(x0, px - nextW + 1);
+            int nextX = rng.range(lowX, std::max(lowX, std::min(x1 - nextW, px + w - 1)));
+            if (!placePlatform(nextX, nextW, row - reach.rise)) break;
+            px = nextX;
+            w = nextW;
+            row -= reach.rise;
+
+            // A side branch: platforms reachable by jumping across from this one.
+            if (rng.chance(25)) {
+                int direction = rng.chance(50) ? 1 : -1;
+                int branchX = px, branchW = w, branchRow = row;
+                for (int b = rng.range(1, MAX_BRANCH); b > 0; --b) {
+                    int gap = rng.range(1, reach.gap);
+                    int nextBranchW = rng.range(MIN_PLATFORM, MAX_PLATFORM);
+                    int nextBranchX = direction > 0 ? branchX + branchW + gap : branchX - gap - nextBranchW;
+                    int nextBranchRow = branchRow + rng.range(-reach.gapRise, reach.gapRise);
+                    if (!placePlatform(nextBranchX, nextBranchW, nextBranchRow)) break;
+                    branchX = nextBranchX;
+                    branchW = nextBranchW;
+                    branchRow = nextBranchRow;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+// --- Non-Member Function Implementations ---
+
+// Generates the level band by band, in parallel.
+bool generateLevel(const LevelGenParams& params, Level& level, unsigned int threadCount) {
+    const int width = (int)params.size.x, height = (int)params.size.y;
+    if (params.size.x < 1 || params.size.y < 8 || params.size.x > MAX_SIDE || params.size.y > MAX_SIDE ||
+        (std::uint64_t)params.size.x * params.size.y > MAX_TILES) {
+        std::cerr << "Error generating level: " << params.size.x << "x" << params.size.y << " is not at least 1x8, at most "
+                  << MAX_SIDE << " tiles on a side and at most " << MAX_TILES << " tiles" << std::endl;
+        return false;
+    }
+    const JumpReach reach = computeJumpReach();
+    GroundRange ground;
+    ground.bottom = height - 2; // At least two rows of ground
+    ground.top = std::max(ground.bottom - std::min(MAX_GROUND_RANGE, (height - TOP_MARGIN - 2) / 2),
+                          TOP_MARGIN + reach.rise);
+    ground.top = std::min(ground.top, ground.bottom);
+
+    level.resize(params.size);
+    level.enemySpawns.clear();
+    const int bandCount = (width + BAND_WIDTH - 1) / BAND_WIDTH;
+    if (threadCount == 1 || bandCount == 1) {
+        for (int band = 0; band < bandCount; ++band) generateBand(params, reach, ground, band, level);
+    } else {
+        // Bands write disjoint columns of the grid, so they need no locking.
+        ThreadPool pool(threadCount);
+        for (int band = 0; band < bandCount; ++band) {
+            pool.submit([&, band] { generateBand(params, reach, ground, band, level); });
+        }
+        pool.waitIdle();
+    }
+
+    // Spawn above the first span (at least 3 tiles wide, no wall in its first columns).
+    int spawnX = std::min(1, width - 1);
+    int spawnRow = getBoundaryRow(params.seed, 0, ground);
+    level.spawnPoint = {(spawnX + 0.5f) * TILE_SIZE, TILE_SIZE * (spawnRow - 2.f)};
+    level.rebuildTileIndexes();
+    return true;
+}
+
+bool isGeneratedLevelName(const std::string& name) {
+    return name.compare(0, 5, "@gen:") == 0;
+}
+
+// Parses "@gen:<width>x<height>[:<seed>]" and generates it.
+bool generateLevelFromName(const std::string& name, Level& level, unsigned int threadCount) {
+    LevelGenParams params;
+    unsigned int width = 0, height = 0;
+    unsigned long long seed = params.seed;
+    int fields = std::sscanf(name.c_str(), "@gen:%ux%u:%llu", &width, &height, &seed);
+    if (fields < 2) {
+        std::cerr << "Error: " << name << " is not @gen:<width>x<height>[:<seed>]" << std::endl;
+        return false;
+    }
+    params.size = {width, height};
+    params.seed = seed;
+    return generateLevel(params, level, threadCount);
+}
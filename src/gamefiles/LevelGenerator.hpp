@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <SFML/System/Vector2.hpp> // For sf::Vector2u
+#include "Level.hpp"               // Level is filled in
+
+// --- Procedural Levels ---
+// Seeded stress-test maps of any size: rolling ground with pits and low walls, and
+// staircases of one-way platforms (with side branches) climbing towards the top. Every
+// step, gap and platform stays within what one jump can reach (derived from the physics
+// constants), so the whole level can be walked from the spawn point.
+//
+// The level is generated in fixed bands of columns, one task per band on a thread pool.
+// Each band draws its random numbers from (seed, band) alone, and the ground height where
+// two bands meet comes from (seed, boundary), so bands never wait on each other and the
+// result is the same for a seed whatever the thread count.
+struct LevelGenParams {
+    sf::Vector2u size = {1024, 64}; // Tiles; at least 1 x 8, at most 100000 on a side
+                                    // and 100 M in all (e.g. 100000 x 1000)
+    std::uint64_t seed = 1;
+    unsigned int coinPercent = 12;  // Chance of a coin above each ground or platform tile
+};
+
+// Fills 'level' with a generated map, using 'threadCount' threads (0 means one per
+// hardware thread). Prints the problem to std::cerr and returns false if the size is
+// out of range.
+bool generateLevel(const LevelGenParams& params, Level& level, unsigned int threadCount = 0);
+
+// Level names of the form "@gen:<width>x<height>[:<seed>]", e.g. "@gen:4096x256:7", which
+// the tools accept wherever they take a level file.
+bool isGeneratedLevelName(const std::string& name);
+// Generates the level 'name' describes. Prints the problem to std::cerr and returns
+// false if it is malformed.
+bool generateLevelFromName(const std::string& name, Level& level, unsigned int threadCount = 0);
@@ -0,0 +1,174 @@
+#include "LevelStream.hpp" // Include the header definition for LevelStream
+#include "LevelFile.hpp"   // For LevelFileHeader
+#include <algorithm>       // For std::sort, std::min, std::max
+#include <cmath>           // For std::floor
+#include <cstdlib>         // For std::abs
+#include <cstring>         // For std::memcmp
+#include <iostream>        // For std::cerr
+
+// --- Member Function Implementations ---
+
+// Destructor
+LevelStream::~LevelStream() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeIo.notify_one();
+    if (ioThread.joinable()) {
+        ioThread.join();
+    }
+}
+
+// Reads the .dlvl header and starts the I/O thread.
+bool LevelStream::open(const std::string& filePath, std::size_t maxResident) {
+    std::ifstream file(filePath, std::ios::binary);
+    LevelFileHeader header;
+    if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        std::cerr << "Error opening streamed level: " << filePath << std::endl;
+        return false;
+    }
+    if (std::memcmp(header.magic, "DLVL", 4) != 0 || header.version != LEVEL_FILE_VERSION ||
+        header.tileSize != (std::uint32_t)TILE_SIZE) {
+        std::cerr << "Error opening streamed level: " << filePath << " is not a compatible .dlvl file" << std::endl;
+        return false;
+    }
+    // The spawn section sits between the header and the payload and is read once, here.
+    if (header.payloadOffset < sizeof(header)) {
+        std::cerr << "Error opening streamed level: " << filePath << " is truncated" << std::endl;
+        return false;
+    }
+    std::vector<char> section((std::size_t)std::min<std::uint64_t>(header.payloadOffset - sizeof(header),
+                                                                   (std::uint64_t)header.spawnCount * sizeof(float) * 2));
+    if (!file.read(section.data(), (std::streamsize)section.size())) {
+        std::cerr << "Error opening streamed level: " << filePath << " is truncated" << std::endl;
+        return false;
+    }
+    if (!readLevelSpawns(header, section.data(), section.size(), enemySpawns)) {
+        return false;
+    }
+
+    path = filePath;
+    size = {header.width, header.height};
+    spawnPoint = {header.spawnX, header.spawnY};
+    payloadOffset = header.payloadOffset;
+    maxResidentChunks = std::max<std::size_t>(maxResident, 1);
+    ioThread = std::thread([this] { ioLoop(); });
+    return true;
+}
+
+// Requests the chunks around 'center', takes over finished loads and evicts old chunks.
+void LevelStream::update(sf::Vector2f center, sf::Vector2f halfExtent, std::vector<sf::Vector2i>& changedChunks) {
+    updateCounter++;
+
+    // --- 1. Take over chunks the I/O thread finished (only a pointer swap under the lock) ---
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<Chunk>>> arrived;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        arrived.swap(completed);
+    }
+    for (auto& entry : arrived) {
+        if (resident.count(entry.first)) continue; // Requested twice, keep the first copy
+        entry.second->lastUsed = updateCounter;
+        changedChunks.push_back({(int)(entry.first & 0xFFFFFFFFu), (int)(entry.first >> 32)});
+        resident.emplace(entry.first, std::move(entry.second));
+    }
+
+    // --- 2. Work out which chunks are wanted, nearest to the camera first ---
+    const float chunkPixels = (float)LEVEL_CHUNK_SIZE * TILE_SIZE;
+    int lastCx = (int)((size.x + LEVEL_CHUNK_SIZE - 1) / LEVEL_CHUNK_SIZE) - 1;
+    int lastCy = (int)((size.y + LEVEL_CHUNK_SIZE - 1) / LEVEL_CHUNK_SIZE) - 1;
+    int minCx = std::max(0, (int)std::floor((center.x - halfExtent.x) / chunkPixels) - 1);
+    int maxCx = std::min(lastCx, (int)std::floor((center.x + halfExtent.x) / chunkPixels) + 1);
+    int minCy = std::max(0, (int)std::floor((center.y - halfExtent.y) / chunkPixels) - 1);
+    int maxCy = std::min(lastCy, (int)std::floor((center.y + halfExtent.y) / chunkPixels) + 1);
+    int centerCx = (int)std::floor(center.x / chunkPixels);
+    int centerCy = (int)std::floor(center.y / chunkPixels);
+
+    std::vector<std::pair<int, std::uint64_t>> missing; // (distance, key)
+    for (int cy = minCy; cy <= maxCy; ++cy) {
+        for (int cx = minCx; cx <= maxCx; ++cx) {
+            auto it = resident.find(chunkKey(cx, cy));
+            if (it != resident.end()) {
+                it->second->lastUsed = updateCounter;
+            } else {
+                missing.push_back({std::abs(cx - centerCx) + std::abs(cy - centerCy), chunkKey(cx, cy)});
+            }
+        }
+    }
+    // Farthest first: the I/O thread pops from the back.
+    std::sort(missing.begin(), missing.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.clear(); // Chunks that scrolled out of range before loading are dropped
+        for (const auto& entry : missing) requests.push_back(entry.second);
+    }
+    if (!missing.empty()) wakeIo.notify_one();
+
+    // --- 3. Evict least recently wanted chunks over budget ---
+    if (resident.size() > maxResidentChunks) {
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> candidates; // (lastUsed, key)
+        for (const auto& entry : resident) {
+            // Chunks wanted this frame stay; modified chunks stay so collected coins don't respawn.
+            if (entry.second->lastUsed < updateCounter && !entry.second->modified) {
+                candidates.push_back({entry.second->lastUsed, entry.first});
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        for (std::size_t i = 0; i < candidates.size() && resident.size() > maxResidentChunks; ++i) {
+            std::uint64_t key = candidates[i].second;
+            resident.erase(key);
+            changedChunks.push_back({(int)(key & 0xFFFFFFFFu), (int)(key >> 32)});
+        }
+        cachedKey = ~std::uint64_t(0);
+        cachedChunk = nullptr;
+    }
+}
+
+// Changes a loaded tile. Returns false if out of bounds or the chunk is not loaded.
+bool LevelStream::setTile(int x, int y, TileType newType) {
+    if (static_cast<unsigned int>(x) >= size.x || static_cast<unsigned int>(y) >= size.y) return false;
+    auto it = resident.find(chunkKey(x / LEVEL_CHUNK_SIZE, y / LEVEL_CHUNK_SIZE));
+    if (it == resident.end()) return false;
+    it->second->tiles[(y % LEVEL_CHUNK_SIZE) * LEVEL_CHUNK_SIZE + (x % LEVEL_CHUNK_SIZE)] = newType;
+    it->second->modified = true;
+    return true;
+}
+
+// Background thread: loads requested chunks one at a time, nearest first.
+void LevelStream::ioLoop() {
+    std::ifstream file(path, std::ios::binary);
+    while (true) {
+        std::uint64_t key;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeIo.wait(lock, [this] { return stopping || !requests.empty(); });
+            if (stopping) return;
+            key = requests.back();
+            requests.pop_back();
+        }
+
+        // Disk I/O happens outside the lock, so update() never waits for it.
+        auto chunk = std::make_unique<Chunk>();
+        readChunk(file, (int)(key & 0xFFFFFFFFu), (int)(key >> 32), *chunk);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        completed.emplace_back(key, std::move(chunk));
+    }
+}
+
+// Reads chunk (cx, cy) from the row-major payload, one chunk-wide strip per tile row.
+// Tiles past the right/bottom edge of the level are Air.
+void LevelStream::readChunk(std::ifstream& file, int cx, int cy, Chunk& chunk) const {
+    chunk.tiles.fill(TileType::Air);
+    int startX = cx * LEVEL_CHUNK_SIZE;
+    int startY = cy * LEVEL_CHUNK_SIZE;
+    int columns = std::min(LEVEL_CHUNK_SIZE, (int)size.x - startX);
+    int rows = std::min(LEVEL_CHUNK_SIZE, (int)size.y - startY);
+    for (int row = 0; row < rows; ++row) {
+        std::uint64_t offset = payloadOffset + (std::uint64_t)(startY + row) * size.x + startX;
+        file.seekg((std::streamoff)offset);
+        file.read(reinterpret_cast<char*>(&chunk.tiles[row * LEVEL_CHUNK_SIZE]), columns);
+    }
+    file.clear(); // A short read (corrupt file) leaves Air rather than a stuck stream
+}
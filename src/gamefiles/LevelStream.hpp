@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <SFML/System/Vector2.hpp> // For sf::Vector2u / sf::Vector2f
+#include "Constants.hpp"            // For LEVEL_CHUNK_SIZE
+#include "TileGrid.hpp"             // For TileType
+
+// Streams the tiles of a .dlvl file in LEVEL_CHUNK_SIZE x LEVEL_CHUNK_SIZE chunks, so
+// levels far larger than memory can be played.
+//
+// A background I/O thread loads the chunks around the camera; update() (called once per
+// frame) hands finished chunks over and evicts the least recently needed ones once more
+// than 'maxResidentChunks' are loaded. The frame thread never waits on the disk: a tile
+// whose chunk has not arrived yet reads as Air.
+//
+// Everything except the I/O thread's internals must be used from one thread (the one
+// that owns the Level).
+class LevelStream {
+public:
+    // Tiles of one chunk, row-major.
+    struct Chunk {
+        std::array<TileType, LEVEL_CHUNK_SIZE * LEVEL_CHUNK_SIZE> tiles;
+        std::uint64_t lastUsed = 0; // update() counter when the chunk was last wanted
+        bool modified = false;      // Changed by setTile; kept in memory instead of evicted
+    };
+
+    LevelStream() = default;
+    ~LevelStream();
+
+    LevelStream(const LevelStream&) = delete;
+    LevelStream& operator=(const LevelStream&) = delete;
+
+    // Reads the .dlvl header and starts the I/O thread. Prints the problem to std::cerr
+    // and returns false on failure.
+    bool open(const std::string& path, std::size_t maxResident);
+
+    // Requests the chunks covering 'center' +- 'halfExtent' (pixels) plus one chunk of
+    // margin, takes over finished loads and evicts old chunks. Appends the coordinates of
+    // every chunk whose contents appeared or disappeared to 'changedChunks'.
+    void update(sf::Vector2f center, sf::Vector2f halfExtent, std::vector<sf::Vector2i>& changedChunks);
+
+    // Tile at (x, y); Air if out of bounds or not loaded yet.
+    TileType getTile(int x, int y) const {
+        if (static_cast<unsigned int>(x) >= size.x || static_cast<unsigned int>(y) >= size.y) return TileType::Air;
+        const Chunk* chunk = findChunk(x / LEVEL_CHUNK_SIZE, y / LEVEL_CHUNK_SIZE);
+        if (!chunk) return TileType::Air;
+        return chunk->tiles[(y % LEVEL_CHUNK_SIZE) * LEVEL_CHUNK_SIZE + (x % LEVEL_CHUNK_SIZE)];
+    }
+    // Changes a loaded tile. Returns false if out of bounds or the chunk is not loaded.
+    bool setTile(int x, int y, TileType newType);
+
+    // Is the chunk holding tile (x, y) loaded?
+    bool isLoaded(int x, int y) const { return findChunk(x / LEVEL_CHUNK_SIZE, y / LEVEL_CHUNK_SIZE) != nullptr; }
+
+    sf::Vector2u getSize() const { return size; }
+    sf::Vector2f getSpawnPoint() const { return spawnPoint; }
+    const std::vector<sf::Vector2f>& getEnemySpawns() const { return enemySpawns; }
+    std::size_t getResidentCount() const { return resident.size(); }
+
+private:
+    static std::uint64_t chunkKey(int cx, int cy) { return ((std::uint64_t)(std::uint32_t)cy << 32) | (std::uint32_t)cx; }
+
+    // Resident chunk lookup with a one-entry cache, since consecutive lookups almost
+    // always hit the same chunk.
+    const Chunk* findChunk(int cx, int cy) const {
+        std::uint64_t key = chunkKey(cx, cy);
+        if (key == cachedKey) return cachedChunk;
+        auto it = resident.find(key);
+        if (it == resident.end()) return nullptr; // Misses aren't cached, the chunk may arrive soon
+        cachedKey = key;
+        cachedChunk = it->second.get();
+        return cachedChunk;
+    }
+    void ioLoop();
+    void readChunk(std::ifstream& file, int cx, int cy, Chunk& chunk) const;
+
+    // --- File Layout (read-only after open) ---
+    std::string path;
+    sf::Vector2u size;                     // Level size in tiles
+    sf::Vector2f spawnPoint;               // From the header
+    std::vector<sf::Vector2f> enemySpawns; // From the spawn section
+    std::uint64_t payloadOffset = 0;       // Start of the tile payload in the file
+
+    // --- Frame Thread State ---
+    std::unordered_map<std::uint64_t, std::unique_ptr<Chunk>> resident;
+    std::size_t maxResidentChunks = 0;
+    std::uint64_t updateCounter = 0;
+    mutable std::uint64_t cachedKey = ~std::uint64_t(0);
+    mutable const Chunk* cachedChunk = nullptr;
+
+    // --- Shared With The I/O Thread (guarded by 'mutex') ---
+    std::mutex mutex;
+    std::condition_variable wakeIo;
+    std::vector<std::uint64_t> requests;                       // Chunks to load, nearest first
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<Chunk>>> completed; // Loaded, not yet handed over
+    bool stopping = false;
+    std::thread ioThread;
+};
@@ -0,0 +1,79 @@
+#include "MappedFile.hpp" // Include the header definition for MappedFile
+#include <cstring>        // For std::strerror
+#include <iostream>       // For std::cerr
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DAVE_HAS_MMAP 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+// --- Member Function Implementations ---
+
+// Destructor
+MappedFile::~MappedFile() {
+    close();
+}
+
+// Maps 'path'. Prints the problem to std::cerr and returns false on failure.
+bool MappedFile::open(const std::string& path) {
+    close();
+#ifdef DAVE_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error opening " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        std::cerr << "Error reading " << path << ": empty or unreadable file" << std::endl;
+        ::close(fd);
+        return false;
+    }
+    // MAP_PRIVATE + PROT_WRITE: tiles can be modified in place (coins collected) without
+    // touching the file; only the written pages get copied.
+    void* address = mmap(nullptr, (std::size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps its own reference to the file
+    if (address == MAP_FAILED) {
+        std::cerr << "Error mapping " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    data = static_cast<unsigned char*>(address);
+    size = (std::size_t)info.st_size;
+    mapped = true;
+    return true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "Error opening " << path << std::endl;
+        return false;
+    }
+    size = (std::size_t)file.tellg();
+    data = new unsigned char[size];
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data), (std::streamsize)size)) {
+        std::cerr << "Error reading " << path << std::endl;
+        close();
+        return false;
+    }
+    return true;
+#endif
+}
+
+// Unmaps the file (also done by the destructor).
+void MappedFile::close() {
+    if (!data) return;
+#ifdef DAVE_HAS_MMAP
+    if (mapped) munmap(data, size);
+#else
+    delete[] data;
+#endif
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
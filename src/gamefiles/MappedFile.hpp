@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Read-write, copy-on-write view of a whole file.
+// On POSIX systems the file is mmap'ed privately: pages are read lazily on first access
+// and writes stay in this process, they never reach the file. Elsewhere the file is read
+// into memory, which gives the same semantics at the cost of an up-front read.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Maps 'path'. Prints the problem to std::cerr and returns false on failure.
+    bool open(const std::string& path);
+    // Unmaps the file (also done by the destructor).
+    void close();
+
+    unsigned char* getData() const { return data; }
+    std::size_t getSize() const { return size; }
+
+private:
+    unsigned char* data = nullptr; // Start of the mapping
+    std::size_t size = 0;          // Length of the file in bytes
+    bool mapped = false;           // true for mmap, false for the heap fallback
+};
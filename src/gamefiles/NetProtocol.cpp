@@ -0,0 +1,249 @@
+#include "NetProtocol.hpp" // Include the header definition for the wire format
+#include "EntityStore.hpp" // Player bodies
+#include "Player.hpp"      // Player::entity, Player::score
+#include <cmath>           // For std::lround
+
+// --- NetWriter ---
+
+void NetWriter::writeU32(std::uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        bytes.push_back((std::uint8_t)(value >> shift));
+    }
+}
+
+void NetWriter::writeU64(std::uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        bytes.push_back((std::uint8_t)(value >> shift));
+    }
+}
+
+void NetWriter::writeVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+        bytes.push_back((std::uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back((std::uint8_t)value);
+}
+
+void NetWriter::writeSignedVarint(std::int64_t value) {
+    writeVarint(((std::uint64_t)value << 1) ^ (std::uint64_t)(value >> 63));
+}
+
+// --- NetReader ---
+
+bool NetReader::readU8(std::uint8_t& value) {
+    if (!ok || position >= size) return ok = false;
+    value = data[position++];
+    return true;
+}
+
+bool NetReader::readU32(std::uint32_t& value) {
+    if (!ok || size - position < 4) return ok = false;
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= (std::uint32_t)data[position++] << (8 * i);
+    }
+    return true;
+}
+
+bool NetReader::readU64(std::uint64_t& value) {
+    if (!ok || size - position < 8) return ok = false;
+    value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= (std::uint64_t)data[position++] << (8 * i);
+    }
+    return true;
+}
+
+bool NetReader::readVarint(std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        std::uint8_t byte;
+        if (!readU8(byte)) return false;
+        value |= (std::uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return ok = false; // Longer than any 64-bit value
+}
+
+bool NetReader::readSignedVarint(std::int64_t& value) {
+    std::uint64_t zigzag;
+    if (!readVarint(zigzag)) return false;
+    value = (std::int64_t)(zigzag >> 1) ^ -(std::int64_t)(zigzag & 1);
+    return true;
+}
+
+// --- Player States ---
+
+bool NetPlayerState::operator==(const NetPlayerState& other) const {
+    return id == other.id && x == other.x && y == other.y && velocityX == other.velocityX &&
+           velocityY == other.velocityY && flags == other.flags && score == other.score;
+}
+
+NetPlayerState capturePlayerState(const Player& player, const EntityStore& entities, std::uint8_t id) {
+    std::size_t entity = player.entity;
+    NetPlayerState state;
+    state.id = id;
+    state.x = (std::int32_t)std::lround(entities.posX[entity] * NET_POSITION_SCALE);
+    state.y = (std::int32_t)std::lround(entities.posY[entity] * NET_POSITION_SCALE);
+    state.velocityX = (std::int32_t)std::lround(entities.velX[entity] * NET_VELOCITY_SCALE);
+    state.velocityY = (std::int32_t)std::lround(entities.velY[entity] * NET_VELOCITY_SCALE);
+    state.flags = entities.hasFlag(entity, ENTITY_ON_GROUND) ? NET_PLAYER_ON_GROUND : 0;
+    state.score = player.score;
+    return state;
+}
+
+void applyPlayerState(const NetPlayerState& state, Player& player, EntityStore& entities) {
+    std::size_t entity = player.entity;
+    entities.posX[entity] = state.x / NET_POSITION_SCALE;
+    entities.posY[entity] = state.y / NET_POSITION_SCALE;
+    entities.velX[entity] = state.velocityX / NET_VELOCITY_SCALE;
+    entities.velY[entity] = state.velocityY / NET_VELOCITY_SCALE;
+    entities.setFlag(entity, ENTITY_ON_GROUND, (state.flags & NET_PLAYER_ON_GROUND) != 0);
+    player.score = state.score;
+}
+
+// --- NetStateHistory ---
+
+void NetStateHistory::store(std::uint64_t tick, const std::vector<NetPlayerState>& players) {
+    Entry& entry = entries[tick % NET_HISTORY_TICKS];
+    entry.tick = tick;
+    entry.players = players; // Reuses the slot's capacity
+}
+
+const std::vector<NetPlayerState>* NetStateHistory::find(std::uint64_t tick) const {
+    const Entry& entry = entries[tick % NET_HISTORY_TICKS];
+    return tick != 0 && entry.tick == tick ? &entry.players : nullptr;
+}
+
+// --- State Messages ---
+// Layout after the type byte:
+//     varint tick, u8 flags (1 = has base, 2 = all tiles), [varint tick - baseTick],
+//     varint lastInputSeq, u8 localPlayer,
+//     varint tileCount, tileCount x { varint x, varint y, u8 type },
+//     varint playerCount, playerCount x { u8 id, u8 changed, changed fields }
+// 'changed' has one bit per field that differs from the player's baseline (or from zero
+// without one), in the order below; each such field follows as the signed difference,
+// except flags, which follow as they are.
+namespace {
+
+const std::uint8_t STATE_HAS_BASE = 1;
+const std::uint8_t STATE_ALL_TILES = 2;
+
+const std::uint8_t FIELD_X = 1;
+const std::uint8_t FIELD_Y = 2;
+const std::uint8_t FIELD_VELOCITY_X = 4;
+const std::uint8_t FIELD_VELOCITY_Y = 8;
+const std::uint8_t FIELD_FLAGS = 16;
+const std::uint8_t FIELD_SCORE = 32;
+
+// The baseline of player 'id' in 'base', or an all-zero state if it has none.
+NetPlayerState findBaseline(const std::vector<NetPlayerState>* base, std::uint8_t id) {
+    if (base) {
+        for (const NetPlayerState& state : *base) {
+            if (state.id == id) return state;
+        }
+    }
+    NetPlayerState zero;
+    zero.id = id;
+    return zero;
+}
+
+} // namespace
+
+void encodeState(const StateMessage& message, const std::vector<NetPlayerState>* base,
+                 std::vector<std::uint8_t>& bytes) {
+    NetWriter writer(bytes);
+    writer.writeU8((std::uint8_t)PacketType::State);
+    writer.writeVarint(message.tick);
+    bool hasBase = base && message.baseTick != 0;
+    writer.writeU8((hasBase ? STATE_HAS_BASE : 0) | (message.allTiles ? STATE_ALL_TILES : 0));
+    if (hasBase) {
+        writer.writeVarint(message.tick - message.baseTick);
+    }
+    writer.writeVarint(message.lastInputSeq);
+    writer.writeU8(message.localPlayer);
+
+    writer.writeVarint(message.tiles.size());
+    for (const NetTile& tile : message.tiles) {
+        writer.writeVarint((std::uint32_t)tile.x);
+        writer.writeVarint((std::uint32_t)tile.y);
+        writer.writeU8((std::uint8_t)tile.type);
+    }
+
+    writer.writeVarint(message.players.size());
+    for (const NetPlayerState& state : message.players) {
+        NetPlayerState old = findBaseline(hasBase ? base : nullptr, state.id);
+        std::uint8_t changed = (state.x != old.x ? FIELD_X : 0) | (state.y != old.y ? FIELD_Y : 0) |
+                               (state.velocityX != old.velocityX ? FIELD_VELOCITY_X : 0) |
+                               (state.velocityY != old.velocityY ? FIELD_VELOCITY_Y : 0) |
+                               (state.flags != old.flags ? FIELD_FLAGS : 0) |
+                               (state.score != old.score ? FIELD_SCORE : 0);
+        writer.writeU8(state.id);
+        writer.writeU8(changed);
+        if (changed & FIELD_X) writer.writeSignedVarint((std::int64_t)state.x - old.x);
+        if (changed & FIELD_Y) writer.writeSignedVarint((std::int64_t)state.y - old.y);
+        if (changed & FIELD_VELOCITY_X) writer.writeSignedVarint((std::int64_t)state.velocityX - old.velocityX);
+        if (changed & FIELD_VELOCITY_Y) writer.writeSignedVarint((std::int64_t)state.velocityY - old.velocityY);
+        if (changed & FIELD_FLAGS) writer.writeU8(state.flags);
+        if (changed & FIELD_SCORE) writer.writeSignedVarint((std::int64_t)state.score - old.score);
+    }
+}
+
+bool decodeState(const std::uint8_t* data, std::size_t size, const NetStateHistory& history,
+                 StateMessage& message) {
+    NetReader reader(data, size);
+    std::uint8_t type = 0, flags = 0;
+    std::uint64_t tick = 0, baseDistance = 0, lastInputSeq = 0;
+    reader.readU8(type);
+    reader.readVarint(tick);
+    reader.readU8(flags);
+    if (flags & STATE_HAS_BASE) {
+        reader.readVarint(baseDistance);
+    }
+    reader.readVarint(lastInputSeq);
+    reader.readU8(message.localPlayer);
+    if (!reader.isOk() || type != (std::uint8_t)PacketType::State || tick == 0 || baseDistance > tick) return false;
+
+    message.tick = tick;
+    message.baseTick = (flags & STATE_HAS_BASE) ? tick - baseDistance : 0;
+    message.lastInputSeq = (std::uint32_t)lastInputSeq;
+    message.allTiles = (flags & STATE_ALL_TILES) != 0;
+    const std::vector<NetPlayerState>* base = nullptr;
+    if (message.baseTick != 0) {
+        base = history.find(message.baseTick);
+        if (!base) return false; // Delta against a state we no longer have
+    }
+
+    std::uint64_t tileCount = 0;
+    if (!reader.readVarint(tileCount) || tileCount > size) return false; // Each tile takes 3+ bytes
+    message.tiles.resize((std::size_t)tileCount);
+    for (NetTile& tile : message.tiles) {
+        std::uint64_t x = 0, y = 0;
+        std::uint8_t tileType = 0;
+        reader.readVarint(x);
+        reader.readVarint(y);
+        reader.readU8(tileType);
+        tile.x = (std::int32_t)x;
+        tile.y = (std::int32_t)y;
+        tile.type = (TileType)tileType;
+    }
+
+    std::uint64_t playerCount = 0;
+    if (!reader.readVarint(playerCount) || playerCount > NET_MAX_ROOM_PLAYERS) return false;
+    message.players.resize((std::size_t)playerCount);
+    for (NetPlayerState& state : message.players) {
+        std::uint8_t id = 0, changed = 0;
+        reader.readU8(id);
+        reader.readU8(changed);
+        state = findBaseline(base, id);
+        std::int64_t delta = 0;
+        if ((changed & FIELD_X) && reader.readSignedVarint(delta)) state.x = (std::int32_t)(state.x + delta);
+        if ((changed & FIELD_Y) && reader.readSignedVarint(delta)) state.y = (std::int32_t)(state.y + delta);
+        if ((changed & FIELD_VELOCITY_X) && reader.readSignedVarint(delta)) state.velocityX = (std::int32_t)(state.velocityX + delta);
+        if ((changed & FIELD_VELOCITY_Y) && reader.readSignedVarint(delta)) state.velocityY = (std::int32_t)(state.velocityY + delta);
+        if (changed & FIELD_FLAGS) reader.readU8(state.flags);
+        if ((changed & FIELD_SCORE) && reader.readSignedVarint(delta)) state.score = (std::int32_t)(state.score + delta);
+    }
+    return reader.isOk() && reader.isAtEnd();
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Level.hpp" // TileType
+
+struct EntityStore;
+struct Player;
+
+// --- Wire Format ---
+// Everything the multiplayer server and its clients send each other over UDP. A packet is
+// one message: a PacketType byte followed by its fields. Integers are LEB128 varints
+// (signed ones zigzag-encoded first) unless noted, so small numbers take one byte.
+//
+//   Join     client -> server  u32 magic, u32 room
+//   Welcome  server -> client  u32 room, u8 player id (NET_NO_PLAYER if the room is full
+//                              or the server cannot open another room), u64 level checksum
+//   Input    client -> server  ack tick, newest input sequence number, u8 count,
+//                              count x u8 INPUT_* mask (newest first)
+//   State    server -> client  see encodeState()
+//
+// Inputs are sent with the previous NET_INPUT_REDUNDANCY - 1 inputs, so a lost packet
+// costs nothing as long as one of the next few arrives. States are delta-compressed
+// against the newest state the client acknowledged (its ack tick): only the tiles set
+// since then, and only the player fields that changed. Lost states are never resent;
+// the next one simply covers more.
+const std::uint32_t NET_PROTOCOL_MAGIC = 0x45564144;  // "DAVE"
+const unsigned short NET_DEFAULT_PORT = 47000;
+const std::uint32_t NET_HISTORY_TICKS = 64;      // States kept as delta baselines (power of two)
+const std::uint32_t NET_INPUT_REDUNDANCY = 8;    // Inputs per Input packet
+const std::uint32_t NET_MAX_INPUT_BACKLOG = 6;   // Server skips ahead if more inputs are waiting
+const std::uint32_t NET_MAX_ROOM_PLAYERS = 8;
+const std::uint32_t NET_DEFAULT_MAX_ROOMS = 64;  // Each room holds a copy of the level
+const std::uint64_t NET_TIMEOUT_TICKS = 300;     // Server drops clients silent this long (5 s)
+const std::uint64_t NET_JOIN_RETRY_TICKS = 30;   // Client resends Join until welcomed
+const std::uint8_t NET_NO_PLAYER = 0xFF;
+const float NET_POSITION_SCALE = 8.f;    // Positions are sent in 1/8 pixels
+const float NET_VELOCITY_SCALE = 256.f;  // Velocities in 1/256 pixels per tick
+
+enum class PacketType : std::uint8_t {
+    Join = 1,
+    Welcome = 2,
+    Input = 3,
+    State = 4,
+};
+
+// --- Byte Streams ---
+// Appends fields to a packet.
+class NetWriter {
+public:
+    explicit NetWriter(std::vector<std::uint8_t>& bytes) : bytes(bytes) {}
+
+    void writeU8(std::uint8_t value) { bytes.push_back(value); }
+    void writeU32(std::uint32_t value); // Little-endian, fixed size
+    void writeU64(std::uint64_t value); // Little-endian, fixed size
+    void writeVarint(std::uint64_t value);
+    void writeSignedVarint(std::int64_t value); // Zigzag, so small negatives stay small
+
+private:
+    std::vector<std::uint8_t>& bytes;
+};
+
+// Reads fields back out of a received packet. Every read returns false once the packet
+// is too short or malformed, and keeps returning false, so a parser can read all fields
+// and check once.
+class NetReader {
+public:
+    NetReader(const std::uint8_t* data, std::size_t size) : data(data), size(size) {}
+
+    bool readU8(std::uint8_t& value);
+    bool readU32(std::uint32_t& value);
+    bool readU64(std::uint64_t& value);
+    bool readVarint(std::uint64_t& value);
+    bool readSignedVarint(std::int64_t& value);
+
+    bool isOk() const { return ok; }
+    bool isAtEnd() const { return position == size; }
+
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t position = 0;
+    bool ok = true;
+};
+
+// --- Game State ---
+// Bits of NetPlayerState::flags.
+const std::uint8_t NET_PLAYER_ON_GROUND = 1;
+
+// One player's body, quantized for sending (see NET_POSITION_SCALE, NET_VELOCITY_SCALE).
+struct NetPlayerState {
+    std::uint8_t id = 0;                 // Slot in the room
+    std::int32_t x = 0, y = 0;           // Centre
+    std::int32_t velocityX = 0, velocityY = 0;
+    std::uint8_t flags = 0;              // NET_PLAYER_* bits
+    std::int32_t score = 0;
+
+    bool operator==(const NetPlayerState& other) const;
+    bool operator!=(const NetPlayerState& other) const { return !(*this == other); }
+};
+
+// Quantizes 'player' for sending as player 'id'.
+NetPlayerState capturePlayerState(const Player& player, const EntityStore& entities, std::uint8_t id);
+// Moves 'player' to the (dequantized) received state.
+void applyPlayerState(const NetPlayerState& state, Player& player, EntityStore& entities);
+
+// One tile as sent: its coordinates and new type.
+struct NetTile {
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    TileType type = TileType::Air;
+};
+
+// The server's state of a room at one tick, as sent to one client.
+struct StateMessage {
+    std::uint64_t tick = 0;           // Room tick the state is from (the first is 1)
+    std::uint64_t baseTick = 0;       // State it is a delta against; 0 = none
+    std::uint32_t lastInputSeq = 0;   // Newest of the client's inputs the server has applied
+    std::uint8_t localPlayer = 0;     // The receiving client's player id
+    bool allTiles = false;            // 'tiles' is every tile changed since the level started,
+                                      // not only those since baseTick
+    std::vector<NetTile> tiles;       // Tiles set after baseTick, oldest first
+    std::vector<NetPlayerState> players; // Every player in the room, by id
+};
+
+// Player states of the last NET_HISTORY_TICKS ticks, the baselines states are delta
+// encoded against. The server keeps one per room, a client one of the states it received.
+class NetStateHistory {
+public:
+    void store(std::uint64_t tick, const std::vector<NetPlayerState>& players);
+    // The players at 'tick', or null if that tick is not (or no longer) held.
+    const std::vector<NetPlayerState>* find(std::uint64_t tick) const;
+
+private:
+    struct Entry {
+        std::uint64_t tick = 0; // 0 = empty
+        std::vector<NetPlayerState> players;
+    };
+    std::array<Entry, NET_HISTORY_TICKS> entries;
+};
+
+// Appends 'message' as a State packet to 'bytes'. 'base' are the players at
+// message.baseTick (null if baseTick is 0): a player is sent as the fields that differ
+// from its entry there, and a player identical to it costs two bytes.
+void encodeState(const StateMessage& message, const std::vector<NetPlayerState>* base,
+                 std::vector<std::uint8_t>& bytes);
+// Parses a State packet (type byte included). Looks the baseline up in 'history'. Returns
+// false if the packet is malformed or its baseline is not in 'history'.
+bool decodeState(const std::uint8_t* data, std::size_t size, const NetStateHistory& history,
+                 StateMessage& message);
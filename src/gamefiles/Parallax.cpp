@@ -0,0 +1,226 @@
+#include "Parallax.hpp"  // Include the header definition for ParallaxRenderer
+#include "Level.hpp"     // Level size, for the layer width and vertical anchor
+#include <algorithm>     // For std::clamp, std::max, std::min
+#include <cmath>         // For std::floor, std::fmod
+#include <iostream>      // For std::cerr
+#include <limits>        // For std::numeric_limits
+#include <random>        // For generating the layers
+
+namespace {
+
+const std::uint8_t CELL_EMPTY = 0;
+const std::uint8_t CELL_BODY = 1;
+const std::uint8_t CELL_EDGE = 2;
+
+// Marks an empty ring slot; layer columns go negative left of the level.
+const long long NO_COLUMN = std::numeric_limits<long long>::min();
+
+// Layer column 'column' of a ring 'size' slots wide, for negative columns too.
+unsigned int getSlot(long long column, unsigned int size) {
+    long long slot = column % (long long)size;
+    return (unsigned int)(slot < 0 ? slot + size : slot);
+}
+
+// Appends the two triangles of an axis-aligned quad.
+void appendQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f topLeft, sf::Vector2f size, sf::Color color) {
+    sf::Vector2f a = topLeft, b = {topLeft.x + size.x, topLeft.y}, c = {topLeft.x, topLeft.y + size.y},
+                 d = topLeft + size;
+    for (sf::Vector2f corner : {a, b, c, b, d, c}) {
+        vertices.push_back({corner, color});
+    }
+}
+
+// A ridge along the bottom: column heights from a random walk between the two heights,
+// steps of up to 'roughness' cells, with an edge cell on top.
+void generateRidge(std::vector<std::uint8_t>& cells, unsigned int columns, unsigned int rows, unsigned int minHeight,
+                   unsigned int maxHeight, int roughness, std::mt19937& rng) {
+    std::uniform_int_distribution<int> step(-roughness, roughness);
+    int height = (int)(minHeight + maxHeight) / 2;
+    for (unsigned int x = 0; x < columns; ++x) {
+        height = std::clamp(height + step(rng), (int)minHeight, (int)maxHeight);
+        for (int y = (int)rows - height; y < (int)rows; ++y) {
+            cells[y * columns + x] = y == (int)rows - height ? CELL_EDGE : CELL_BODY;
+        }
+    }
+}
+
+// Fills a layer's cells according to its style.
+void generateCells(const ParallaxLayerDesc& desc, unsigned int columns, std::vector<std::uint8_t>& cells,
+                   std::mt19937& rng) {
+    const unsigned int rows = desc.rows;
+    cells.assign((std::size_t)rows * columns, CELL_EMPTY);
+    switch (desc.style) {
+        case ParallaxStyle::Mountains:
+            generateRidge(cells, columns, rows, rows / 3, rows - 1, 1, rng);
+            break;
+        case ParallaxStyle::Hills:
+            generateRidge(cells, columns, rows, rows / 4, rows * 3 / 4, 1, rng);
+            break;
+        case ParallaxStyle::Clouds: {
+            // About one cloud every 12 columns, in the top third: a wide flat ellipse.
+            std::uniform_int_distribution<unsigned int> column(0, columns - 1), row(1, std::max(1u, rows / 3)),
+                halfWidth(2, 5);
+            for (unsigned int i = 0; i < columns / 12; ++i) {
+                int cx = (int)column(rng), cy = (int)row(rng), rx = (int)halfWidth(rng);
+                for (int y = cy - 1; y <= cy + 1; ++y) {
+                    int half = y == cy ? rx : rx - 2;
+                    for (int x = cx - half; x <= cx + half; ++x) {
+                        if (y < 0 || y >= (int)rows || x < 0 || x >= (int)columns) continue;
+                        cells[y * columns + x] = y == cy + 1 ? CELL_EDGE : CELL_BODY; // Shaded underside
+                    }
+                }
+            }
+            break;
+        }
+        case ParallaxStyle::Grass: {
+            // Tufts on about a third of the columns, mostly one cell high.
+            std::uniform_int_distribution<unsigned int> percent(0, 99), height(1, rows);
+            for (unsigned int x = 0; x < columns; ++x) {
+                if (percent(rng) >= 30) continue;
+                unsigned int tuft = percent(rng) < 80 ? 1 : height(rng);
+                for (unsigned int y = rows - tuft; y < rows; ++y) {
+                    cells[y * columns + x] = y == rows - tuft ? CELL_EDGE : CELL_BODY;
+                }
+            }
+            break;
+        }
+    }
+}
+
+} // namespace
+
+// --- Non-Member Function Implementations ---
+
+std::vector<ParallaxLayerDesc> getDefaultParallaxLayers() {
+    std::vector<ParallaxLayerDesc> layers(4);
+    layers[0] = {ParallaxStyle::Mountains, 0.15f, 20, 18, sf::Color(95, 115, 165), sf::Color(235, 240, 250)};
+    layers[1] = {ParallaxStyle::Clouds, 0.3f, 20, 30, sf::Color(255, 255, 255, 210), sf::Color(215, 225, 240, 210)};
+    layers[2] = {ParallaxStyle::Hills, 0.5f, 20, 9, sf::Color(60, 135, 70), sf::Color(95, 175, 90)};
+    layers[3] = {ParallaxStyle::Grass, 1.3f, 10, 3, sf::Color(30, 90, 35, 220), sf::Color(60, 140, 55, 220), true};
+    return layers;
+}
+
+// --- Member Function Implementations ---
+
+// Generates every layer and creates its cache texture.
+bool ParallaxRenderer::build(const std::vector<ParallaxLayerDesc>& descs, const Level& level, sf::Vector2u screenSize,
+                             std::uint32_t seed) {
+    layers.clear();
+    screen = screenSize;
+    std::mt19937 rng(seed);
+    for (const ParallaxLayerDesc& desc : descs) {
+        Layer layer;
+        layer.desc = desc;
+        layer.desc.cellSize = std::max(1u, desc.cellSize);
+        layer.desc.rows = std::max(1u, desc.rows);
+        const unsigned int cell = layer.desc.cellSize;
+        // Enough slots for every column that can be partly visible at once.
+        layer.ringColumns = (screen.x + cell - 1) / cell + 1;
+        // The layer scrolls 'rate' times the level's width while the camera crosses it.
+        layer.columns = std::max(layer.ringColumns,
+                                 (unsigned int)((level.sizePixels.x * desc.rate + screen.x) / cell) + 1);
+        generateCells(layer.desc, layer.columns, layer.cells, rng);
+
+        sf::Vector2u textureSize = {layer.ringColumns * cell, layer.desc.rows * cell};
+        layer.cache = std::make_unique<sf::RenderTexture>();
+        if (!layer.cache->resize(textureSize)) {
+            std::cerr << "Error creating a " << textureSize.x << "x" << textureSize.y << " parallax layer texture"
+                      << std::endl;
+            layers.clear();
+            return false;
+        }
+        layer.cache->setRepeated(true); // The composite quad wraps around the ring
+        layer.cache->clear(sf::Color::Transparent);
+        layer.cache->display();
+        layer.slotColumns.assign(layer.ringColumns, NO_COLUMN);
+        layers.push_back(std::move(layer));
+    }
+    return true;
+}
+
+// Scrolls the layers and brings their caches up to date.
+void ParallaxRenderer::update(const sf::View& view, const Level& level) {
+    lastColumnsRedrawn = 0;
+    lastRedrawCalls = 0;
+    const double viewLeft = (double)view.getCenter().x - view.getSize().x / 2.0;
+    const double viewBottom = (double)view.getCenter().y + view.getSize().y / 2.0;
+    for (Layer& layer : layers) {
+        const double cell = layer.desc.cellSize;
+        const float width = (float)screen.x, height = (float)(layer.desc.rows * layer.desc.cellSize);
+
+        // Horizontal: the layer's own pixels scroll 'rate' times as fast as the world's.
+        double scroll = viewLeft * layer.desc.rate;
+        // Columns under the first to the last pixel center (a partial column at either end).
+        long long first = (long long)std::floor(scroll / cell);
+        long long last = (long long)std::floor((scroll + width) / cell);
+        redrawColumns(layer, first, last);
+
+        // Vertical: bottom-aligned while the camera is at the bottom of the level, and
+        // moving down as it climbs.
+        float top = (float)(screen.y - height + (level.sizePixels.y - viewBottom) * layer.desc.rate);
+        // Texture coordinates relative to the ring, so they stay small on long levels.
+        double ringWidth = layer.ringColumns * cell;
+        float u = (float)(scroll - std::floor(scroll / ringWidth) * ringWidth);
+        sf::Vector2f corners[4] = {{0.f, top}, {width, top}, {0.f, top + height}, {width, top + height}};
+        sf::Vector2f texCoords[4] = {{u, 0.f}, {u + width, 0.f}, {u, height}, {u + width, height}};
+        const int order[6] = {0, 1, 2, 1, 3, 2};
+        for (int i = 0; i < 6; ++i) {
+            layer.quad[i] = {corners[order[i]], sf::Color::White, texCoords[order[i]]};
+        }
+    }
+}
+
+// Draws the missing columns of [first, last] into their ring slots.
+void ParallaxRenderer::redrawColumns(Layer& layer, long long first, long long last) {
+    const float cell = (float)layer.desc.cellSize;
+    const unsigned int rows = layer.desc.rows;
+    clearVertices.clear();
+    cellVertices.clear();
+    for (long long column = first; column <= last; ++column) {
+        unsigned int slot = getSlot(column, layer.ringColumns);
+        if (caching && layer.slotColumns[slot] == column) continue;
+        layer.slotColumns[slot] = column;
+        lastColumnsRedrawn++;
+
+        // Wipe the slot (whatever column it held), then draw the column's cells into it.
+        float x = slot * cell;
+        appendQuad(clearVertices, {x, 0.f}, {cell, rows * cell}, sf::Color::Transparent);
+        unsigned int patternColumn = getSlot(column, layer.columns);
+        for (unsigned int y = 0; y < rows; ++y) {
+            std::uint8_t value = layer.cells[(std::size_t)y * layer.columns + patternColumn];
+            if (value == CELL_EMPTY) continue;
+            appendQuad(cellVertices, {x, y * cell}, {cell, cell}, value == CELL_EDGE ? layer.desc.edge : layer.desc.body);
+        }
+    }
+    if (clearVertices.empty()) return;
+
+    sf::RenderStates replace;
+    replace.blendMode = sf::BlendNone; // Writes the transparent pixels instead of blending them in
+    layer.cache->draw(clearVertices.data(), clearVertices.size(), sf::PrimitiveType::Triangles, replace);
+    lastRedrawCalls++;
+    if (!cellVertices.empty()) {
+        layer.cache->draw(cellVertices.data(), cellVertices.size(), sf::PrimitiveType::Triangles);
+        lastRedrawCalls++;
+    }
+    layer.cache->display();
+}
+
+void ParallaxRenderer::drawBackground(sf::RenderTarget& target) const {
+    drawLayers(target, false);
+}
+
+void ParallaxRenderer::drawForeground(sf::RenderTarget& target) const {
+    drawLayers(target, true);
+}
+
+// Composites the layers of one side in order, each as one quad in screen space.
+void ParallaxRenderer::drawLayers(sf::RenderTarget& target, bool foreground) const {
+    sf::View previous = target.getView();
+    target.setView(target.getDefaultView());
+    for (const Layer& layer : layers) {
+        if (layer.desc.foreground != foreground) continue;
+        sf::RenderStates states(&layer.cache->getTexture());
+        target.draw(layer.quad.data(), layer.quad.size(), sf::PrimitiveType::Triangles, states);
+    }
+    target.setView(previous);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <SFML/Graphics/Color.hpp>         // Layer colors
+#include <SFML/Graphics/RenderTarget.hpp>  // For sf::RenderTarget
+#include <SFML/Graphics/RenderTexture.hpp> // The cached layer strips
+#include <SFML/Graphics/Vertex.hpp>        // For sf::Vertex
+#include <SFML/Graphics/View.hpp>          // The camera the layers follow
+
+// Forward declaration, the full definition is only needed in Parallax.cpp.
+struct Level;
+
+// What a parallax layer shows; decides how its cells are generated.
+enum class ParallaxStyle : std::uint8_t {
+    Mountains, // A jagged ridge with snowy tops along the bottom
+    Hills,     // Low rolling hills along the bottom
+    Clouds,    // Scattered clouds in the upper rows
+    Grass,     // Sparse tufts along the bottom (meant for the foreground)
+};
+
+// One decorative layer: a grid of flat-colored cells, generated from its style.
+struct ParallaxLayerDesc {
+    ParallaxStyle style = ParallaxStyle::Hills;
+    float rate = 0.5f;          // Scroll speed relative to the camera: < 1 is farther than the level
+    unsigned int cellSize = 20; // Width and height of a cell (pixels)
+    unsigned int rows = 10;     // Height of the layer in cells
+    sf::Color body;             // Cell colors: the filling and the top edge
+    sf::Color edge;
+    bool foreground = false;    // Drawn over the level instead of behind it
+};
+
+// The game's layers: mountains, clouds and hills behind the level, grass in front of it.
+std::vector<ParallaxLayerDesc> getDefaultParallaxLayers();
+
+// Draws parallax layers around the level without redrawing them every frame.
+// Each layer is cached in a render texture a little wider than the screen, used as a ring
+// of cell columns: layer column c lives at texture column c % ringColumns. As the camera
+// scrolls, update() draws only the columns that came into sight, into the slots of the
+// ones that left. The texture repeats, so the whole visible part of a layer is then
+// composited with one textured quad whose texture coordinates start at the scroll offset,
+// whichever slot that falls in. A steady camera costs one quad per layer.
+//
+// Layers are drawn in screen space (they do not zoom with the view), anchored so their
+// bottom is at the bottom of the screen when the camera is at the bottom of the level,
+// and scroll 'rate' times as fast as the camera both ways.
+class ParallaxRenderer {
+public:
+    // Generates the layers for a level as wide as 'level' (the pattern repeats past its
+    // end) and creates their caches for a target of 'screenSize' pixels. Prints the problem
+    // to std::cerr and returns false if a cache texture cannot be created.
+    bool build(const std::vector<ParallaxLayerDesc>& descs, const Level& level, sf::Vector2u screenSize,
+               std::uint32_t seed);
+
+    // Scrolls every layer to follow 'view' and redraws the columns that came into sight.
+    void update(const sf::View& view, const Level& level);
+    // Composites the layers behind / in front of the level, one quad each.
+    void drawBackground(sf::RenderTarget& target) const;
+    void drawForeground(sf::RenderTarget& target) const;
+
+    // Off: update() redraws every visible column each frame, as drawing the layers tile by
+    // tile would. For benchmarks; on by default.
+    void setCaching(bool enabled) { caching = enabled; }
+
+    // Statistics of the last update() and draw*() calls.
+    unsigned int getColumnsRedrawn() const { return lastColumnsRedrawn; }
+    unsigned int getDrawCalls() const { return lastRedrawCalls + (unsigned int)layers.size(); }
+
+private:
+    struct Layer {
+        ParallaxLayerDesc desc;
+        unsigned int columns = 0;          // Pattern width in cells; it repeats after that
+        std::vector<std::uint8_t> cells;   // rows x columns, row-major: 0 empty, 1 body, 2 edge
+        std::unique_ptr<sf::RenderTexture> cache; // ringColumns cells wide, repeated
+        unsigned int ringColumns = 0;
+        std::vector<long long> slotColumns; // Layer column each slot holds, if any
+        std::array<sf::Vertex, 6> quad;     // Composite quad, screen space, set by update()
+    };
+
+    // Redraws layer columns [first, last] that are not in their slots (all of them if
+    // caching is off).
+    void redrawColumns(Layer& layer, long long first, long long last);
+    void drawLayers(sf::RenderTarget& target, bool foreground) const;
+
+    std::vector<Layer> layers;
+    sf::Vector2u screen;
+    bool caching = true;
+    std::vector<sf::Vertex> clearVertices; // Reused by redrawColumns()
+    std::vector<sf::Vertex> cellVertices;
+    unsigned int lastColumnsRedrawn = 0;
+    unsigned int lastRedrawCalls = 0;
+};
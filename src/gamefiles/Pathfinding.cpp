@@ -0,0 +1,381 @@
+#include "Pathfinding.hpp"    // Include the header definition for the pathfinding types
+#include "Constants.hpp"      // TILE_SIZE, physics and AI constants
+#include "EntityStore.hpp"    // Enemies being steered
+#include "Level.hpp"          // Tiles copied into requests
+#include "TileProperties.hpp" // TILE_SOLID, TILE_ONE_WAY, TILE_HAZARD
+#include <algorithm>          // For std::min, std::max, std::clamp
+#include <cmath>              // For std::ceil, std::floor
+#include <cstdlib>            // For std::abs
+#include <functional>         // For std::greater
+#include <queue>              // For the Dijkstra frontier
+#include <utility>            // For std::pair
+
+// --- Movement Limits ---
+
+// Bundles the movement values of a body.
+MovementLimits computeMovementLimits(float moveSpeed, float jumpVelocity, float gravity, sf::Vector2f halfSize) {
+    MovementLimits limits;
+    limits.moveSpeed = moveSpeed;
+    limits.jumpVelocity = jumpVelocity;
+    limits.gravity = gravity;
+    limits.halfSize = halfSize;
+    limits.walkTicks = (int)std::ceil(TILE_SIZE / moveSpeed);
+    return limits;
+}
+
+// --- Flow Field ---
+
+namespace {
+
+// A move from one standing cell to another, stored with its destination (the search runs
+// backwards from the target, so it needs each cell's incoming moves).
+struct Move {
+    std::int32_t from = 0;   // Cell index the move starts at
+    std::uint16_t ticks = 0; // Estimated duration
+    std::uint8_t bits = 0;   // FlowMove bits to perform at 'from'
+};
+
+// Read-only view of a request's tile flags. Cells outside the region count as solid, so
+// no planned path leaves it.
+struct RegionTiles {
+    const FlowFieldRequest& request;
+
+    std::uint8_t flags(int x, int y) const {
+        if (x < 0 || y < 0 || x >= request.size.x || y >= request.size.y) return TILE_SOLID;
+        return request.tileFlags[(std::size_t)y * request.size.x + x];
+    }
+    // Can a body stand in (x, y): the cell is passable and safe, and the one below holds it up.
+    bool isStandable(int x, int y) const {
+        return (flags(x, y) & (TILE_SOLID | TILE_ONE_WAY | TILE_HAZARD)) == 0 && y + 1 < request.size.y &&
+               (flags(x, y + 1) & (TILE_SOLID | TILE_ONE_WAY)) != 0;
+    }
+    bool isSolid(int x, int y) const { return (flags(x, y) & TILE_SOLID) != 0; }
+    // Does the box [left, right) x [top, bottom) overlap a tile with any of 'mask'?
+    bool boxTouches(float left, float top, float right, float bottom, std::uint8_t mask) const {
+        int x0 = (int)std::floor((left + COLLISION_EPSILON) / TILE_SIZE);
+        int x1 = (int)std::floor((right - COLLISION_EPSILON) / TILE_SIZE);
+        int y0 = (int)std::floor((top + COLLISION_EPSILON) / TILE_SIZE);
+        int y1 = (int)std::floor((bottom - COLLISION_EPSILON) / TILE_SIZE);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                if (flags(x, y) & mask) return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Where a flight ends: the standing cell and the ticks it took.
+struct Landing {
+    int x = 0;
+    int y = 0;
+    int ticks = 0;
+};
+
+// Follows a body leaving standing cell (x, y) from the middle of it with velocity
+// (velX, velY), tick by tick as the physics would move it (gravity, then position), until
+// it lands. velY == 0 walks off a ledge: gravity only starts once nothing holds the body
+// up. Fails if the body would touch a solid or hazard tile on the way, or stays in the air
+// longer than MAX_AIR_TICKS.
+bool followFlight(const RegionTiles& tiles, const MovementLimits& limits, int x, int y, float velX, float velY,
+                  Landing& landing) {
+    const float halfW = limits.halfSize.x, height = 2.f * limits.halfSize.y;
+    float centerX = (x + 0.5f) * TILE_SIZE;
+    float bottom = (float)(y + 1) * TILE_SIZE;
+    bool supported = velY == 0.f;
+
+    for (int tick = 1; tick <= MovementLimits::MAX_AIR_TICKS; ++tick) {
+        if (supported) {
+            // Still walking: on the ledge while any tile under the body holds it.
+            supported = tiles.boxTouches(centerX - halfW, bottom, centerX + halfW, bottom + 1.f,
+                                         TILE_SOLID | TILE_ONE_WAY);
+        }
+        if (!supported) velY += limits.gravity;
+        centerX += velX;
+        float newBottom = bottom + velY;
+
+        // Landing: the bottom crossed the top of a row with a tile that holds the body.
+        if (velY > 0.f) {
+            int firstRow = (int)std::floor(bottom / TILE_SIZE) + 1;
+            for (int row = firstRow; (float)row * TILE_SIZE <= newBottom; ++row) {
+                float top = (float)row * TILE_SIZE;
+                if (tiles.boxTouches(centerX - halfW, top - height, centerX + halfW, top, TILE_SOLID | TILE_HAZARD)) {
+                    return false; // Hit something on the way down to this row
+                }
+                if (!tiles.boxTouches(centerX - halfW, top, centerX + halfW, top + 1.f, TILE_SOLID | TILE_ONE_WAY)) {
+                    continue;
+                }
+                // Stands on the cell under its middle, or else on the edge that holds it.
+                int landX = (int)std::floor(centerX / TILE_SIZE);
+                if (!tiles.isStandable(landX, row - 1)) {
+                    int leftX = (int)std::floor((centerX - halfW + COLLISION_EPSILON) / TILE_SIZE);
+                    int rightX = (int)std::floor((centerX + halfW - COLLISION_EPSILON) / TILE_SIZE);
+                    landX = tiles.isStandable(leftX, row - 1) ? leftX : rightX;
+                    if (!tiles.isStandable(landX, row - 1)) return false;
+                }
+                landing = {landX, row - 1, tick};
+                return true;
+            }
+        }
+        bottom = newBottom;
+        if (tiles.boxTouches(centerX - halfW, bottom - height, centerX + halfW, bottom, TILE_SOLID | TILE_HAZARD)) {
+            return false; // A wall or ceiling (or spikes) in the way
+        }
+        if (bottom - height > (float)tiles.request.size.y * TILE_SIZE) return false; // Fell out
+    }
+    return false;
+}
+
+std::uint8_t directionBits(float velX) {
+    return velX < 0.f ? FLOW_LEFT : velX > 0.f ? FLOW_RIGHT : FLOW_NONE;
+}
+
+// Calls 'emit(toX, toY, ticks, bits)' for every move from standing cell (x, y): walking
+// to a neighbour, walking off a ledge, and jumping at each planned sideways speed.
+template <typename Emit>
+void forEachMove(const RegionTiles& tiles, const MovementLimits& limits, int x, int y, Emit&& emit) {
+    Landing landing;
+    for (int direction = -1; direction <= 1; direction += 2) {
+        int nx = x + direction;
+        float velX = direction * limits.moveSpeed;
+        if (tiles.isStandable(nx, y)) {
+            emit(nx, y, limits.walkTicks, directionBits(velX));
+        } else if (!tiles.isSolid(nx, y) && followFlight(tiles, limits, x, y, velX, 0.f, landing)) {
+            emit(landing.x, landing.y, landing.ticks, directionBits(velX));
+        }
+    }
+
+    // Straight up (k = 0) only matters for jumping through a one-way platform.
+    for (int k = -MovementLimits::JUMP_SPEED_STEPS; k <= MovementLimits::JUMP_SPEED_STEPS; ++k) {
+        float velX = limits.moveSpeed * (float)k / MovementLimits::JUMP_SPEED_STEPS;
+        if (!followFlight(tiles, limits, x, y, velX, limits.jumpVelocity, landing)) continue;
+        if (landing.x == x && landing.y == y) continue;
+        std::uint8_t bits = (std::uint8_t)(directionBits(velX) | FLOW_JUMP | (std::abs(k) << FLOW_JUMP_SPEED_SHIFT));
+        emit(landing.x, landing.y, landing.ticks, bits);
+    }
+}
+
+} // namespace
+
+// Computes the field for 'request'.
+void computeFlowField(const FlowFieldRequest& request, const MovementLimits& limits, FlowField& field) {
+    const int width = request.size.x, height = request.size.y;
+    const std::size_t cellCount = (std::size_t)width * height;
+    field.sequence = request.sequence;
+    field.origin = request.origin;
+    field.size = request.size;
+    field.target = request.target;
+    field.moves.assign(cellCount, FLOW_NONE);
+    field.cost.assign(cellCount, FlowField::UNREACHABLE);
+    if (cellCount == 0) return;
+    RegionTiles tiles{request};
+
+    // A target in mid-air (the player jumping) leads to where it will land.
+    int targetX = request.target.x - request.origin.x, targetY = request.target.y - request.origin.y;
+    if (targetX < 0 || targetX >= width) return;
+    targetY = std::max(targetY, 0);
+    while (targetY < height && !tiles.isStandable(targetX, targetY)) {
+        if (tiles.isSolid(targetX, targetY)) return; // Inside a wall: nothing to lead to
+        targetY++;
+    }
+    if (targetY >= height) return;
+
+    // Incoming moves of every cell, grouped by destination (counting sort into one array).
+    std::vector<std::pair<std::int32_t, Move>> moves;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (!tiles.isStandable(x, y)) continue;
+            std::int32_t from = y * width + x;
+            forEachMove(tiles, limits, x, y, [&](int toX, int toY, int ticks, std::uint8_t bits) {
+                moves.push_back({toY * width + toX, Move{from, (std::uint16_t)std::min(ticks, 0xFFFE), bits}});
+            });
+        }
+    }
+    std::vector<std::uint32_t> firstIncoming(cellCount + 1, 0);
+    for (const auto& move : moves) firstIncoming[move.first + 1]++;
+    for (std::size_t i = 1; i <= cellCount; ++i) firstIncoming[i] += firstIncoming[i - 1];
+    std::vector<Move> incoming(moves.size());
+    std::vector<std::uint32_t> fill(firstIncoming.begin(), firstIncoming.end() - 1);
+    for (const auto& move : moves) incoming[fill[move.first]++] = move.second;
+
+    // Dijkstra outwards from the target: each cell keeps the move that starts its
+    // cheapest way there.
+    using Entry = std::pair<std::uint32_t, std::int32_t>; // (ticks, cell)
+    std::vector<std::uint32_t> best(cellCount, 0xFFFFFFFFu);
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> frontier;
+    std::int32_t targetCell = targetY * width + targetX;
+    best[targetCell] = 0;
+    field.moves[targetCell] = FLOW_AT_TARGET;
+    frontier.push({0, targetCell});
+    while (!frontier.empty()) {
+        Entry entry = frontier.top();
+        frontier.pop();
+        if (entry.first != best[entry.second]) continue; // Superseded
+        for (std::uint32_t i = firstIncoming[entry.second]; i < firstIncoming[entry.second + 1]; ++i) {
+            const Move& move = incoming[i];
+            std::uint32_t ticks = entry.first + move.ticks;
+            if (ticks < best[move.from]) {
+                best[move.from] = ticks;
+                field.moves[move.from] = move.bits;
+                frontier.push({ticks, move.from});
+            }
+        }
+    }
+    for (std::size_t cell = 0; cell < cellCount; ++cell) {
+        if (best[cell] != 0xFFFFFFFFu) field.cost[cell] = (std::uint16_t)std::min<std::uint32_t>(best[cell], 0xFFFE);
+    }
+}
+
+// --- Background Worker ---
+
+// Starts the worker thread.
+FlowFieldWorker::FlowFieldWorker(const MovementLimits& limits)
+    : limits(limits),
+      thread(&FlowFieldWorker::run, this)
+{
+}
+
+// Stops and joins the worker thread.
+FlowFieldWorker::~FlowFieldWorker() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+// Hands 'request' to the worker.
+void FlowFieldWorker::submit(const FlowFieldRequest& request) {
+    requests.getWriteBuffer() = request; // Reuses the buffer's capacity
+    requests.publish();
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        requestWaiting = true;
+    }
+    wake.notify_one();
+}
+
+// Copies the result of request 'sequence' into 'field', waiting for it first. The worker
+// usually finished long ago; if not, yielding beats sleeping for the short wait left.
+void FlowFieldWorker::collect(std::uint64_t sequence, FlowField& field) {
+    while (true) {
+        results.acquire();
+        const FlowField& result = results.getReadBuffer();
+        if (result.sequence == sequence) {
+            field = result;
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+// Worker thread: sleeps until a request arrives, computes it and publishes the field.
+void FlowFieldWorker::run() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [&] { return requestWaiting || stopping; });
+            if (stopping) return;
+            requestWaiting = false;
+        }
+        if (!requests.acquire()) continue;
+        computeFlowField(requests.getReadBuffer(), limits, results.getWriteBuffer());
+        results.publish();
+    }
+}
+
+// --- Enemy Navigation ---
+
+// Enemies share the player's jump and gravity but run slower.
+EnemyNavigator::EnemyNavigator()
+    : limits(computeMovementLimits(ENEMY_MOVE_SPEED, PLAYER_JUMP_VELOCITY, GRAVITY, {ENEMY_HALF_WIDTH, ENEMY_HALF_HEIGHT}))
+{
+}
+
+// Collects a finished request and sends a new one when needed.
+void EnemyNavigator::update(const Level& level, sf::Vector2i playerTile, std::uint64_t tick, FlowFieldWorker* worker) {
+    if (requestPending && tick >= collectTick) {
+        if (worker) {
+            worker->collect(request.sequence, field);
+        } else {
+            computeFlowField(request, limits, field);
+        }
+        requestPending = false;
+    }
+    if (requestPending) return;
+
+    // The region around the player, clamped to the level.
+    sf::Vector2i size = {std::min(2 * FLOW_FIELD_HALF_WIDTH + 1, (int)level.size.x),
+                         std::min(2 * FLOW_FIELD_HALF_HEIGHT + 1, (int)level.size.y)};
+    sf::Vector2i origin = {std::clamp(playerTile.x - FLOW_FIELD_HALF_WIDTH, 0, (int)level.size.x - size.x),
+                           std::clamp(playerTile.y - FLOW_FIELD_HALF_HEIGHT, 0, (int)level.size.y - size.y)};
+    unsigned int revision = 0;
+    for (int cy = origin.y / LEVEL_CHUNK_SIZE; cy <= (origin.y + size.y - 1) / LEVEL_CHUNK_SIZE; ++cy) {
+        for (int cx = origin.x / LEVEL_CHUNK_SIZE; cx <= (origin.x + size.x - 1) / LEVEL_CHUNK_SIZE; ++cx) {
+            revision += level.getChunkRevision(cx, cy);
+        }
+    }
+    if (field.sequence != 0 && playerTile == lastTarget && revision == lastRevision) return;
+
+    request.sequence++;
+    request.origin = origin;
+    request.size = size;
+    request.target = playerTile;
+    request.tileFlags.resize((std::size_t)size.x * size.y);
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            request.tileFlags[(std::size_t)y * size.x + x] = getTileFlags(level.getTile(origin.x + x, origin.y + y));
+        }
+    }
+    lastTarget = playerTile;
+    lastRevision = revision;
+    requestPending = true;
+    collectTick = tick + FLOW_FIELD_LATENCY_TICKS;
+    if (worker) worker->submit(request);
+}
+
+// Drops the pending request so the next update requests a new field.
+void EnemyNavigator::invalidate(FlowFieldWorker* worker) {
+    if (requestPending && worker) {
+        FlowField discarded;
+        worker->collect(request.sequence, discarded); // Keeps the worker's sequence in step
+    }
+    requestPending = false;
+    lastTarget = {-1, -1};
+}
+
+// Steers every grounded enemy by the field.
+void EnemyNavigator::steer(EntityStore& entities) const {
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        if (entities.kinds[i] != EntityKind::Enemy || !entities.hasFlag(i, ENTITY_ON_GROUND)) continue;
+        // An enemy whose middle hangs over a ledge stands on the cell under one of its edges.
+        sf::Vector2i tile = getStandingTile(entities, i);
+        if (field.getMove(tile.x, tile.y) == FLOW_NONE) {
+            sf::Vector2i left = {(int)std::floor((entities.posX[i] - entities.halfW[i]) / TILE_SIZE), tile.y};
+            sf::Vector2i right = {(int)std::floor((entities.posX[i] + entities.halfW[i]) / TILE_SIZE), tile.y};
+            tile = field.getCost(left.x, left.y) <= field.getCost(right.x, right.y) ? left : right;
+        }
+        std::uint8_t move = field.getMove(tile.x, tile.y);
+        float direction = (move & FLOW_LEFT) ? -1.f : (move & FLOW_RIGHT) ? 1.f : 0.f;
+        if (!(move & FLOW_JUMP)) {
+            entities.velX[i] = direction * limits.moveSpeed;
+            continue;
+        }
+        // Jumps were planned from the middle of the cell: walk there first.
+        float offset = ((float)tile.x + 0.5f) * TILE_SIZE - entities.posX[i];
+        if (std::abs(offset) > 0.5f) {
+            entities.velX[i] = std::clamp(offset, -limits.moveSpeed, limits.moveSpeed);
+            continue;
+        }
+        int speedSteps = (move & FLOW_JUMP_SPEED) >> FLOW_JUMP_SPEED_SHIFT;
+        entities.velX[i] = direction * limits.moveSpeed * (float)speedSteps / MovementLimits::JUMP_SPEED_STEPS;
+        entities.velY[i] = limits.jumpVelocity;
+    }
+}
+
+// Tile containing the bottom center of entity 'index'.
+sf::Vector2i getStandingTile(const EntityStore& entities, std::size_t index) {
+    return {(int)std::floor(entities.posX[index] / TILE_SIZE),
+            (int)std::floor((entities.posY[index] + entities.halfH[index] - COLLISION_EPSILON) / TILE_SIZE)};
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <SFML/System/Vector2.hpp> // For tile coordinates
+#include "TripleBuffer.hpp"        // Requests and results between the simulation and the worker
+
+struct Level;
+struct EntityStore;
+
+// --- Movement Limits ---
+// What a walker can do: its speed, jump and size. The flow field plans every move by
+// following the body tick by tick with these values, the way the physics will move it.
+struct MovementLimits {
+    static constexpr int JUMP_SPEED_STEPS = 4; // Planned jumps move sideways at k/4 of
+                                               // moveSpeed, k = 0..4
+    static constexpr int MAX_AIR_TICKS = 240;  // Longer flights are not planned
+
+    float moveSpeed = 0.f;    // Horizontal speed (pixels/tick)
+    float jumpVelocity = 0.f; // Initial jump velocity (pixels/tick, negative is up)
+    float gravity = 0.f;      // Downward acceleration (pixels/tick^2)
+    sf::Vector2f halfSize;    // Half extents of the body (pixels)
+    int walkTicks = 0;        // Ticks to walk one tile
+};
+
+// Bundles the movement values of a body.
+MovementLimits computeMovementLimits(float moveSpeed, float jumpVelocity, float gravity, sf::Vector2f halfSize);
+
+// --- Flow Field ---
+// Per-cell instruction bits of a FlowField.
+enum FlowMove : std::uint8_t {
+    FLOW_NONE = 0,             // Not a standing spot, or the target can't be reached from it
+    FLOW_LEFT = 1 << 0,        // Walk (or jump) left
+    FLOW_RIGHT = 1 << 1,       // Walk (or jump) right
+    FLOW_JUMP = 1 << 2,        // Jump from the middle of this cell
+    FLOW_AT_TARGET = 1 << 3,   // This is the target cell
+    FLOW_JUMP_SPEED = 7 << 4   // Jumps: sideways speed, in MovementLimits::JUMP_SPEED_STEPS
+};
+constexpr int FLOW_JUMP_SPEED_SHIFT = 4;
+
+// Everything the worker needs to compute a field: a copy of the tile flags around the
+// target, so it never touches the Level the simulation is changing.
+struct FlowFieldRequest {
+    std::uint64_t sequence = 0;          // Increases with every request
+    sf::Vector2i origin;                 // Level tile of cell (0, 0)
+    sf::Vector2i size;                   // Cells (tiles) covered
+    sf::Vector2i target;                 // Level tile to lead to (usually the player's)
+    std::vector<std::uint8_t> tileFlags; // TileFlags of every cell, row-major
+};
+
+// The way to the target from every standing spot (a free cell above a solid or one-way
+// tile) in a region of the level: which way to walk, and whether to jump, to get there in
+// the fewest ticks. One field is shared by every enemy, however many there are.
+struct FlowField {
+    static constexpr std::uint16_t UNREACHABLE = 0xFFFF;
+
+    std::uint64_t sequence = 0;          // Of the request it was computed for; 0 = empty
+    sf::Vector2i origin;                 // Level tile of cell (0, 0)
+    sf::Vector2i size;                   // Cells covered
+    sf::Vector2i target;                 // Level tile the field leads to
+    std::vector<std::uint8_t> moves;     // FlowMove bits per cell, row-major
+    std::vector<std::uint16_t> cost;     // Estimated ticks to the target, or UNREACHABLE
+
+    // FlowMove bits at level tile (x, y); FLOW_NONE outside the field.
+    std::uint8_t getMove(int x, int y) const {
+        x -= origin.x;
+        y -= origin.y;
+        if (x < 0 || y < 0 || x >= size.x || y >= size.y) return FLOW_NONE;
+        return moves[(std::size_t)y * size.x + x];
+    }
+    // Ticks to the target from level tile (x, y); UNREACHABLE outside the field.
+    std::uint16_t getCost(int x, int y) const {
+        x -= origin.x;
+        y -= origin.y;
+        if (x < 0 || y < 0 || x >= size.x || y >= size.y) return UNREACHABLE;
+        return cost[(std::size_t)y * size.x + x];
+    }
+};
+
+// Computes the field for 'request' (a pure function of its inputs). Runs a Dijkstra search
+// outwards from the target over reversed walk, fall and jump moves. Falls and jumps are
+// followed tick by tick, so a move is only planned if the body clears every tile on the way.
+void computeFlowField(const FlowFieldRequest& request, const MovementLimits& limits, FlowField& field);
+
+// --- Background Worker ---
+// Computes flow fields on its own thread. The simulation submits a request and, a fixed
+// number of ticks later, collects the result (waiting only if the worker is behind), so
+// the enemies behave identically whether fields are computed here or inline.
+class FlowFieldWorker {
+public:
+    explicit FlowFieldWorker(const MovementLimits& limits);
+    ~FlowFieldWorker();
+
+    FlowFieldWorker(const FlowFieldWorker&) = delete;
+    FlowFieldWorker& operator=(const FlowFieldWorker&) = delete;
+
+    // Hands 'request' to the worker. Only one request may be outstanding at a time.
+    void submit(const FlowFieldRequest& request);
+    // Copies the result of the request with 'sequence' into 'field', waiting for it first.
+    void collect(std::uint64_t sequence, FlowField& field);
+
+private:
+    void run();
+
+    MovementLimits limits;
+    TripleBuffer<FlowFieldRequest> requests; // Simulation -> worker
+    TripleBuffer<FlowField> results;         // Worker -> simulation
+    std::mutex wakeMutex;                    // Only for sleeping while idle
+    std::condition_variable wake;
+    bool requestWaiting = false;             // Guarded by wakeMutex
+    bool stopping = false;                   // Guarded by wakeMutex
+    std::thread thread;
+};
+
+// --- Enemy Navigation ---
+// The simulation's side of pathfinding: keeps a flow field towards the player current and
+// steers enemies by it. Copyable, so a Simulation stays copyable.
+struct EnemyNavigator {
+    // --- Member Variables ---
+    MovementLimits limits;         // Of the enemies
+    FlowField field;               // The field enemies currently steer by
+    FlowFieldRequest request;      // The last request sent
+    bool requestPending = false;   // Is 'request' still to be collected?
+    std::uint64_t collectTick = 0; // Tick on which the pending request is collected
+    sf::Vector2i lastTarget{-1, -1};   // Target of the last request
+    unsigned int lastRevision = 0;     // Sum of the chunk revisions it covered
+
+    // --- Member Functions (Declarations) ---
+    EnemyNavigator();
+
+    // Collects a finished request on its tick, and requests a new field when the player has
+    // moved to another tile or the tiles around it changed. 'worker' may be null, then
+    // fields are computed inline on the collect tick.
+    void update(const Level& level, sf::Vector2i playerTile, std::uint64_t tick, FlowFieldWorker* worker);
+    // Drops the pending request (waiting for 'worker' to finish it, if there is one) so the
+    // next update requests a new field. For when the simulation jumps to another tick.
+    void invalidate(FlowFieldWorker* worker);
+    // Sets the horizontal velocity of every grounded enemy from the field, and makes it
+    // jump where the field says so (after lining up with the middle of the cell, where
+    // the jump was planned from). Airborne enemies keep their momentum, as planned.
+    void steer(EntityStore& entities) const;
+};
+
+// Tile containing the bottom center of entity 'index' (where it stands).
+sf::Vector2i getStandingTile(const EntityStore& entities, std::size_t index);
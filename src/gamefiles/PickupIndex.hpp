@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Per-chunk count of pickup tiles (coins, gems) in a level, kept up to date by Level::setTile.
+// Lets coin collection skip the tile checks entirely when no pickups are in the chunks the
+// player overlaps, and gives the number of remaining coins in O(1).
+struct PickupIndex {
+    // --- Member Variables ---
+    std::vector<std::uint16_t> chunkCounts; // Coins per chunk, row-major (at most 64*64 fits)
+    std::vector<bool> chunkCounted;         // Streamed levels: has the chunk been counted yet?
+    std::size_t chunksPerRow = 0;           // Width of the chunk grid
+    std::size_t remaining = 0;              // Coins left in all counted chunks
+
+    // --- Member Functions ---
+    // Clears the index for a level of 'columns' x 'rows' chunks.
+    void reset(std::size_t columns, std::size_t rows) {
+        chunksPerRow = columns;
+        chunkCounts.assign(columns * rows, 0);
+        chunkCounted.assign(columns * rows, false);
+        remaining = 0;
+    }
+
+    // Coins in chunk (cx, cy); the chunk must exist.
+    std::uint16_t getCount(int cx, int cy) const { return chunkCounts[cy * chunksPerRow + cx]; }
+
+    // Adds 'delta' coins to chunk (cx, cy).
+    void add(int cx, int cy, int delta) {
+        chunkCounts[cy * chunksPerRow + cx] = (std::uint16_t)(chunkCounts[cy * chunksPerRow + cx] + delta);
+        remaining = (std::size_t)((long long)remaining + delta);
+    }
+};
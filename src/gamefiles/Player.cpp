@@ -1,119 +1,79 @@
 #include "Player.hpp"      // Include the header definition for Player
-#include "Level.hpp"       // Include the full definition of Level (needed for getTile)
+#include "Level.hpp"       // Include the full definition of Level (needed for sizes/spawn)
+#include "EntityStore.hpp" // Include the full definition of EntityStore (the player's body)
 #include "Constants.hpp"   // Include global constants
-#include <SFML/Graphics/Rect.hpp> // Needed for sf::FloatRect
-#include <iostream>        // Needed for std::cout (in handleLevelBounds)
-#include <cmath>           // Needed for std::sqrt (not used here but often in physics)
 
 
 // --- Member Function Implementations ---
 
 // Constructor
-Player::Player(sf::Vector2f startPos)
-    : velocity(0.f, 0.f), // Initialize velocity using member initializer list
-      isOnGround(false),  // Initialize isOnGround
+Player::Player(EntityStore& entities, sf::Vector2f startPos)
+    : entity(entities.create(EntityKind::Player, startPos, {TILE_SIZE * 0.4f, TILE_SIZE * 0.475f},
+                             ENTITY_ALIVE | ENTITY_COLLIDES_TILES)), // 80% x 95% of a tile
       score(0)            // Initialize score
 {
-    shape.setSize({TILE_SIZE * 0.8f, TILE_SIZE * 0.95f});
-    shape.setFillColor(sf::Color::Green);
-    shape.setOrigin({shape.getSize().x / 2.f, shape.getSize().y / 2.f});
-    shape.setPosition(startPos);
 }
 
-// Apply gravity
-void Player::applyGravity() {
-    velocity.y += GRAVITY;
+// Body accessors
+sf::Vector2f Player::getPosition(const EntityStore& entities) const {
+    return entities.getPosition(entity);
 }
 
-// Jump action
-void Player::jump() {
-    if (isOnGround) {
-        velocity.y = PLAYER_JUMP_VELOCITY;
-        isOnGround = false;
-    }
+sf::Vector2f Player::getSize(const EntityStore& entities) const {
+    return entities.getHalfSize(entity) * 2.f;
 }
 
-// Update position based on velocity
-void Player::updatePosition() {
-    shape.move(velocity);
+sf::FloatRect Player::getBounds(const EntityStore& entities) const {
+    sf::Vector2f halfSize = entities.getHalfSize(entity);
+    return {entities.getPosition(entity) - halfSize, halfSize * 2.f};
 }
 
-// Handle collision with solid tiles
-void Player::handleCollision(const Level& level) {
-    isOnGround = false;
-    sf::FloatRect playerBounds = shape.getGlobalBounds();
-
-    // --- Vertical Collision Check ---
-    sf::FloatRect verticalCheckBounds = playerBounds;
-    verticalCheckBounds.position.y += velocity.y;
-    int leftTileV = static_cast<int>((verticalCheckBounds.position.x + COLLISION_EPSILON) / TILE_SIZE);
-    int rightTileV = static_cast<int>((verticalCheckBounds.position.x + verticalCheckBounds.size.x - COLLISION_EPSILON) / TILE_SIZE);
-    int topTileV = static_cast<int>((verticalCheckBounds.position.y + COLLISION_EPSILON) / TILE_SIZE);
-    int bottomTileV = static_cast<int>((verticalCheckBounds.position.y + verticalCheckBounds.size.y - COLLISION_EPSILON) / TILE_SIZE);
+bool Player::isOnGround(const EntityStore& entities) const {
+    return entities.hasFlag(entity, ENTITY_ON_GROUND);
+}
 
-    for (int x = leftTileV; x <= rightTileV; ++x) {
-        if (velocity.y > 0 && level.getTile(x, bottomTileV) == TileType::Solid) {
-            shape.setPosition({shape.getPosition().x, (float)bottomTileV * TILE_SIZE - shape.getSize().y / 2.f});
-            velocity.y = 0;
-            isOnGround = true;
-            playerBounds = shape.getGlobalBounds();
-            break;
-        }
-        if (velocity.y < 0 && level.getTile(x, topTileV) == TileType::Solid) {
-            shape.setPosition({shape.getPosition().x, (float)(topTileV + 1) * TILE_SIZE + shape.getSize().y / 2.f});
-            velocity.y = 0;
-            playerBounds = shape.getGlobalBounds();
-            break;
-        }
+// Jump action
+void Player::jump(EntityStore& entities) {
+    if (isOnGround(entities)) {
+        entities.velY[entity] = PLAYER_JUMP_VELOCITY;
+        entities.setFlag(entity, ENTITY_ON_GROUND, false);
     }
+}
 
-    // --- Horizontal Collision Check ---
-    sf::FloatRect horizontalCheckBounds = playerBounds;
-    horizontalCheckBounds.position.x += velocity.x;
-    int leftTileH = static_cast<int>((horizontalCheckBounds.position.x + COLLISION_EPSILON) / TILE_SIZE);
-    int rightTileH = static_cast<int>((horizontalCheckBounds.position.x + horizontalCheckBounds.size.x - COLLISION_EPSILON) / TILE_SIZE);
-    int topTileH = static_cast<int>((playerBounds.position.y + COLLISION_EPSILON) / TILE_SIZE);
-    int bottomTileH = static_cast<int>((playerBounds.position.y + playerBounds.size.y - COLLISION_EPSILON) / TILE_SIZE);
-
-    for (int y = topTileH; y <= bottomTileH; ++y) {
-         if (velocity.x > 0 && level.getTile(rightTileH, y) == TileType::Solid) {
-            shape.setPosition({(float)rightTileH * TILE_SIZE - shape.getSize().x / 2.f, shape.getPosition().y});
-            velocity.x = 0;
-            break;
-        }
-        if (velocity.x < 0 && level.getTile(leftTileH, y) == TileType::Solid) {
-            shape.setPosition({(float)(leftTileH + 1) * TILE_SIZE + shape.getSize().x / 2.f, shape.getPosition().y});
-            velocity.x = 0;
-            break;
-        }
-    }
+// Horizontal movement from the held direction keys (right wins if both are held)
+void Player::setHorizontalInput(EntityStore& entities, bool left, bool right) {
+    float velocityX = 0.f;
+    if (left) velocityX = -PLAYER_MOVE_SPEED;
+    if (right) velocityX = PLAYER_MOVE_SPEED;
+    entities.velX[entity] = velocityX;
 }
 
 // Handle collision with level boundaries
-void Player::handleLevelBounds(const Level& level) {
-    sf::Vector2f playerPos = shape.getPosition();
-    sf::Vector2f playerHalfSize = shape.getSize() / 2.f;
+bool Player::handleLevelBounds(EntityStore& entities, const Level& level) {
+    sf::Vector2f playerPos = entities.getPosition(entity);
+    sf::Vector2f playerHalfSize = entities.getHalfSize(entity);
 
     // Left
     if (playerPos.x - playerHalfSize.x < 0.f) {
-        shape.setPosition({playerHalfSize.x, playerPos.y});
-        velocity.x = 0;
+        entities.posX[entity] = playerHalfSize.x;
+        entities.velX[entity] = 0;
     }
     // Right
     if (playerPos.x + playerHalfSize.x > level.sizePixels.x) {
-        shape.setPosition({level.sizePixels.x - playerHalfSize.x, playerPos.y});
-        velocity.x = 0;
+        entities.posX[entity] = level.sizePixels.x - playerHalfSize.x;
+        entities.velX[entity] = 0;
     }
     // Top
     if (playerPos.y - playerHalfSize.y < 0.f) {
-        shape.setPosition({playerPos.x, playerHalfSize.y});
-        velocity.y = 0;
+        entities.posY[entity] = playerHalfSize.y;
+        entities.velY[entity] = 0;
     }
     // Bottom (Fall out)
     if (playerPos.y + playerHalfSize.y > level.sizePixels.y) {
-        std::cout << "Player fell out of bounds!" << std::endl;
-        shape.setPosition({TILE_SIZE * 1.5f, TILE_SIZE * (level.size.y - 3.f)}); // Reset
-        velocity = {0.f, 0.f};
-        isOnGround = false;
+        entities.setPosition(entity, level.spawnPoint); // Reset
+        entities.setVelocity(entity, {0.f, 0.f});
+        entities.setFlag(entity, ENTITY_ON_GROUND, false);
+        return true;
     }
+    return false;
 }
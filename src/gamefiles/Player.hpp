@@ -1,31 +1,39 @@
 #pragma once
 
-#include <SFML/Graphics/RectangleShape.hpp> // For sf::RectangleShape
-#include <SFML/System/Vector2.hpp>         // For sf::Vector2f
+#include <cstddef>                  // For std::size_t
+#include <SFML/Graphics/Rect.hpp>   // For sf::FloatRect (header-only, no window needed)
+#include <SFML/System/Vector2.hpp>  // For sf::Vector2f
 
-// Forward declaration of Level struct to avoid circular includes.
-// We only need to know that 'Level' exists here, not its full definition.
-// The full definition is included in Player.cpp where it's needed.
+// Forward declarations to avoid circular includes.
+// We only need to know that these exist here, not their full definitions.
+// The full definitions are included in Player.cpp where they're needed.
 struct Level;
+struct EntityStore;
 
 // Structure to group together data and functions for the player character.
+// The player's body (position, velocity, size, on-ground flag) is one entry in the
+// level's EntityStore and moves with the batched physics passes like every other
+// entity; this struct only holds the index of that entry and player-only state.
 struct Player {
     // --- Member Variables ---
-    sf::RectangleShape shape;    // Visual representation
-    sf::Vector2f velocity;       // Current movement speed/direction
-    bool isOnGround;             // Is the player standing on a solid tile?
+    std::size_t entity;          // Index of the player's body in the EntityStore
     int score;                   // Player's score (e.g., collected coins)
 
     // --- Member Functions (Declarations) ---
-    // Constructor
-    Player(sf::Vector2f startPos);
+    // Constructor: adds the player's body to 'entities' at 'startPos'.
+    Player(EntityStore& entities, sf::Vector2f startPos);
 
-    // Physics & Movement
-    void applyGravity();
-    void jump();
-    void updatePosition();
+    // Body accessors
+    sf::Vector2f getPosition(const EntityStore& entities) const; // Center of the bounding box
+    sf::Vector2f getSize(const EntityStore& entities) const;     // Width and height (pixels)
+    sf::FloatRect getBounds(const EntityStore& entities) const;  // Bounding box in world pixels
+    bool isOnGround(const EntityStore& entities) const;          // Standing on a solid tile?
 
-    // Collision Handling
-    void handleCollision(const Level& level); // Collision with solid tiles
-    void handleLevelBounds(const Level& level); // Collision with level edges
+    // Movement
+    void jump(EntityStore& entities);
+    // Sets horizontal velocity from the held direction keys.
+    void setHorizontalInput(EntityStore& entities, bool left, bool right);
+
+    // Collision with level edges. Returns true if the player fell out and was respawned.
+    bool handleLevelBounds(EntityStore& entities, const Level& level);
 };
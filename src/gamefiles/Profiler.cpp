@@ -0,0 +1,195 @@
+#include "Profiler.hpp" // Include the header definition for Profiler
+#include <algorithm>    // For std::nth_element, std::min
+#include <chrono>       // For std::chrono::steady_clock
+#include <fstream>      // For std::ofstream (writeTrace)
+#include <iomanip>      // For std::setprecision
+#include <iostream>     // For std::cerr
+
+// --- Names ---
+
+const char* getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Frame: return "Frame";
+        case ProfilePhase::Events: return "Events";
+        case ProfilePhase::Input: return "Input";
+        case ProfilePhase::Assets: return "Assets";
+        case ProfilePhase::Ai: return "Ai";
+        case ProfilePhase::Physics: return "Physics";
+        case ProfilePhase::Pickups: return "Pickups";
+        case ProfilePhase::Camera: return "Camera";
+        case ProfilePhase::DrawLevel: return "DrawLevel";
+        case ProfilePhase::Display: return "Display";
+        default: return "?";
+    }
+}
+
+const char* getCounterName(ProfileCounter counter) {
+    switch (counter) {
+        case ProfileCounter::DrawCalls: return "Draw calls";
+        case ProfileCounter::TilesDrawn: return "Tiles drawn";
+        case ProfileCounter::ResidentChunks: return "Resident chunks";
+        case ProfileCounter::Entities: return "Entities";
+        case ProfileCounter::ParallaxColumns: return "Parallax columns";
+        default: return "?";
+    }
+}
+
+// --- Member Function Implementations ---
+
+namespace {
+
+std::uint64_t steadyNowNs() {
+    return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Small per-thread ids, so traces show thread 0, 1, 2... instead of opaque handles.
+std::uint32_t getThreadIndex() {
+    static std::atomic<std::uint32_t> nextIndex{0};
+    thread_local std::uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace
+
+// Constructor
+Profiler::Profiler()
+    : epochNs(steadyNowNs() - 1), // now() is never 0, which ScopedTimer uses for "disabled"
+      slots(RING_SIZE)
+{
+}
+
+// Nanoseconds since the profiler was created.
+std::uint64_t Profiler::now() const {
+    return steadyNowNs() - epochNs;
+}
+
+// Claims a slot and publishes the sample in it (seqlock-style, see Slot).
+void Profiler::record(ProfilePhase phase, std::uint64_t startNs, std::uint64_t endNs) {
+    std::uint64_t duration = std::min<std::uint64_t>(endNs - startNs, 0xFFFFFFFFu);
+    std::uint64_t packed = duration | (std::uint64_t)(getThreadIndex() & 0xFFFFFFu) << 32 |
+                           (std::uint64_t)phase << 56;
+
+    std::uint64_t index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots[index & (RING_SIZE - 1)];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.start.store(startNs, std::memory_order_relaxed);
+    slot.packed.store(packed, std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+// Drains the ring into the rolling windows and the trace.
+void Profiler::endFrame() {
+    std::array<std::uint64_t, PHASE_COUNT> frameNs{};
+
+    std::uint64_t written = writeIndex.load(std::memory_order_acquire);
+    if (written - readIndex > RING_SIZE) {
+        // The writers lapped us: everything older than one ring is gone.
+        droppedSamples += written - readIndex - RING_SIZE;
+        readIndex = written - RING_SIZE;
+    }
+    while (readIndex < written) {
+        Slot& slot = slots[readIndex & (RING_SIZE - 1)];
+        const std::uint64_t expected = 2 * readIndex + 2;
+        std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence < expected) break; // Claimed but not finished yet: pick it up next frame
+        std::uint64_t start = slot.start.load(std::memory_order_relaxed);
+        std::uint64_t packed = slot.packed.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        readIndex++;
+        if (sequence != expected || slot.sequence.load(std::memory_order_relaxed) != expected) {
+            droppedSamples++; // Overwritten by a later sample
+            continue;
+        }
+
+        ProfileSample sample;
+        sample.startNs = start;
+        sample.durationNs = (std::uint32_t)(packed & 0xFFFFFFFFu);
+        sample.thread = (std::uint32_t)((packed >> 32) & 0xFFFFFFu);
+        sample.phase = (ProfilePhase)(packed >> 56);
+        if (sample.phase >= ProfilePhase::Count) continue;
+        frameNs[(std::size_t)sample.phase] += sample.durationNs;
+        if (tracing && trace.size() < maxTraceSamples) {
+            trace.push_back(sample);
+        }
+    }
+
+    for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase) {
+        window[phase][windowCursor] = (float)(frameNs[phase] / 1e6);
+    }
+    windowCursor = (windowCursor + 1) % WINDOW_FRAMES;
+    windowFrames = std::min(windowFrames + 1, WINDOW_FRAMES);
+}
+
+// Rolling statistics of one phase over the last WINDOW_FRAMES frames.
+PhaseStats Profiler::getPhaseStats(ProfilePhase phase) const {
+    PhaseStats stats;
+    if (windowFrames == 0) return stats;
+    const std::array<float, WINDOW_FRAMES>& frames = window[(std::size_t)phase];
+    stats.lastMs = frames[(windowCursor + WINDOW_FRAMES - 1) % WINDOW_FRAMES];
+
+    // Partial sorts of a stack copy: no allocation, and the window is only 1 KB.
+    std::array<float, WINDOW_FRAMES> sorted = frames;
+    auto begin = sorted.begin(), end = sorted.begin() + windowFrames;
+    auto p50 = begin + windowFrames / 2;
+    auto p99 = begin + std::min(windowFrames - 1, windowFrames * 99 / 100);
+    std::nth_element(begin, p50, end);
+    stats.p50Ms = *p50;
+    std::nth_element(begin, p99, end);
+    stats.p99Ms = *p99;
+    return stats;
+}
+
+// Keeps drained samples for writeTrace().
+void Profiler::startTrace(std::size_t maxSamples) {
+    tracing = true;
+    maxTraceSamples = maxSamples;
+    trace.clear();
+    trace.reserve(std::min<std::size_t>(maxSamples, 1 << 16));
+}
+
+// Writes the recorded trace as Chrome trace JSON or CSV.
+bool Profiler::writeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cerr << "Error creating trace file: " << path << std::endl;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3); // Nanosecond resolution in microseconds
+    bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+    if (json) {
+        // "Complete" events; timestamps and durations are in microseconds.
+        file << "{\"traceEvents\":[\n";
+        for (std::size_t i = 0; i < trace.size(); ++i) {
+            const ProfileSample& sample = trace[i];
+            file << "{\"name\":\"" << getPhaseName(sample.phase) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                 << sample.thread << ",\"ts\":" << sample.startNs / 1e3 << ",\"dur\":" << sample.durationNs / 1e3
+                 << "}" << (i + 1 < trace.size() ? ",\n" : "\n");
+        }
+        file << "],\"displayTimeUnit\":\"ms\"}\n";
+    } else {
+        file << "phase,thread,start_us,duration_us\n";
+        for (const ProfileSample& sample : trace) {
+            file << getPhaseName(sample.phase) << ',' << sample.thread << ',' << sample.startNs / 1e3 << ','
+                 << sample.durationNs / 1e3 << '\n';
+        }
+    }
+    if (!file) {
+        std::cerr << "Error writing trace file: " << path << std::endl;
+        return false;
+    }
+    if (tracing && trace.size() >= maxTraceSamples) {
+        std::cerr << "Trace truncated at " << maxTraceSamples << " samples" << std::endl;
+    }
+    return true;
+}
+
+// --- Non-Member Function Implementation ---
+
+// The process-wide profiler used by ScopedTimer.
+Profiler& getProfiler() {
+    static Profiler profiler;
+    return profiler;
+}
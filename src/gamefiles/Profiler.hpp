@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Parts of a frame that are timed. Physics and Pickups are recorded inside Simulation::step,
+// so they cover every tick run during the frame.
+enum class ProfilePhase : std::uint8_t {
+    Frame = 0,  // The whole frame, from event polling to display
+    Events,     // window.pollEvent loop
+    Input,      // Reading the keyboard state
+    Assets,     // Finishing asset loads and hot reloads
+    Ai,         // Enemy pathfinding and steering
+    Physics,    // Player and entity movement, tile collision
+    Pickups,    // Coin collection and entity contacts
+    Camera,     // View update and chunk streaming
+    DrawLevel,  // Drawing the tiles
+    Display,    // window.display (includes waiting for the frame limit)
+    Count
+};
+
+// Values recorded once per frame next to the phase timings.
+enum class ProfileCounter : std::uint8_t {
+    DrawCalls = 0,  // Draw calls issued by the tile renderer
+    TilesDrawn,     // Non-empty tiles in the chunks that were drawn
+    ResidentChunks, // Chunks in memory (streamed levels only)
+    Entities,       // Bodies in the EntityStore
+    ParallaxColumns, // Parallax columns redrawn into their caches
+    Count
+};
+
+// Short display names, e.g. "DrawLevel".
+const char* getPhaseName(ProfilePhase phase);
+const char* getCounterName(ProfileCounter counter);
+
+// One timed scope, as kept for trace export.
+struct ProfileSample {
+    std::uint64_t startNs = 0;    // Since the profiler was created
+    std::uint32_t durationNs = 0; // Clamped to ~4.3 s
+    std::uint32_t thread = 0;     // Small per-thread id, in order of first use
+    ProfilePhase phase = ProfilePhase::Frame;
+};
+
+// Rolling frame-time statistics of one phase, in milliseconds per frame.
+struct PhaseStats {
+    float lastMs = 0.f;
+    float p50Ms = 0.f;
+    float p99Ms = 0.f;
+};
+
+// Collects phase timings from any thread through a fixed-size lock-free ring buffer.
+// record() never blocks or allocates, so timers stay on in release builds. Once per frame
+// the main thread calls endFrame(), which drains the ring into per-phase rolling windows
+// (and into the trace when one is being recorded). If writers lap the reader between two
+// endFrame() calls the oldest samples are dropped and counted.
+class Profiler {
+public:
+    static constexpr std::size_t RING_SIZE = 8192;    // Samples buffered between drains
+    static constexpr std::size_t WINDOW_FRAMES = 256; // Frames the percentiles are taken over
+
+    Profiler();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Timers do nothing while disabled (the default), e.g. in headless tools.
+    void setEnabled(bool enabled) { enabledFlag.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabledFlag.load(std::memory_order_relaxed); }
+
+    // Nanoseconds since the profiler was created (steady clock).
+    std::uint64_t now() const;
+
+    // Any thread: records that 'phase' ran from 'startNs' to 'endNs'. Lock-free.
+    void record(ProfilePhase phase, std::uint64_t startNs, std::uint64_t endNs);
+    // Consumer thread: sets a counter for the current frame.
+    void setCounter(ProfileCounter counter, std::uint64_t value) { counters[(std::size_t)counter] = value; }
+
+    // Consumer thread: drains the ring, closing the current frame.
+    void endFrame();
+
+    PhaseStats getPhaseStats(ProfilePhase phase) const;
+    std::uint64_t getCounter(ProfileCounter counter) const { return counters[(std::size_t)counter]; }
+    std::uint64_t getDroppedSamples() const { return droppedSamples; }
+
+    // Keeps every drained sample, up to 'maxSamples' (24 bytes each), for writeTrace().
+    void startTrace(std::size_t maxSamples);
+    // Writes the recorded trace: Chrome trace JSON (chrome://tracing, Perfetto) if 'path'
+    // ends in .json, CSV otherwise. Prints the problem to std::cerr and returns false on failure.
+    bool writeTrace(const std::string& path) const;
+
+private:
+    static constexpr std::size_t PHASE_COUNT = (std::size_t)ProfilePhase::Count;
+
+    // A ring slot guarded by a sequence number (odd while being written), so the reader
+    // can tell a finished sample from one that is in progress or was overwritten.
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint64_t> start{0};
+        std::atomic<std::uint64_t> packed{0}; // duration | thread << 32 | phase << 56
+    };
+
+    std::atomic<bool> enabledFlag{false};
+    std::uint64_t epochNs = 0;
+
+    alignas(64) std::atomic<std::uint64_t> writeIndex{0}; // Next slot to claim (all writers)
+    alignas(64) std::uint64_t readIndex = 0;              // Next slot to drain (consumer only)
+    std::vector<Slot> slots;                              // RING_SIZE entries
+    std::uint64_t droppedSamples = 0;
+
+    // Per-phase milliseconds of the last WINDOW_FRAMES frames, as a ring.
+    std::array<std::array<float, WINDOW_FRAMES>, PHASE_COUNT> window{};
+    std::size_t windowFrames = 0; // Frames in the window so far (<= WINDOW_FRAMES)
+    std::size_t windowCursor = 0; // Slot the next frame goes into
+    std::array<std::uint64_t, (std::size_t)ProfileCounter::Count> counters{};
+
+    bool tracing = false;
+    std::size_t maxTraceSamples = 0;
+    std::vector<ProfileSample> trace;
+};
+
+// The process-wide profiler used by ScopedTimer.
+Profiler& getProfiler();
+
+// Times the enclosing scope as 'phase' on the process-wide profiler.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(ProfilePhase phase)
+        : phase(phase), startNs(getProfiler().isEnabled() ? getProfiler().now() : 0) {}
+    ~ScopedTimer() {
+        if (startNs != 0) getProfiler().record(phase, startNs, getProfiler().now());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfilePhase phase;
+    std::uint64_t startNs; // 0 if the profiler was disabled when the scope began
+};
@@ -0,0 +1,62 @@
+#include "ProfilerHud.hpp" // Include the header definition for ProfilerHud
+#include <cstdio>          // For std::snprintf
+
+namespace {
+
+const float HUD_REFRESH_SECONDS = 0.25f;
+const unsigned int HUD_CHARACTER_SIZE = 14;
+const sf::Vector2f HUD_POSITION = {10.f, 50.f}; // Below the score
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Constructor
+ProfilerHud::ProfilerHud(const sf::Font& font)
+    : text(font, "", HUD_CHARACTER_SIZE)
+{
+    text.setFillColor(sf::Color::White);
+    text.setPosition(HUD_POSITION + sf::Vector2f(6.f, 4.f));
+    backdrop.setFillColor(sf::Color(0, 0, 0, 160));
+    backdrop.setPosition(HUD_POSITION);
+    buffer.reserve(1024);
+}
+
+// Rebuilds the text if visible and the refresh interval has passed.
+void ProfilerHud::update(const Profiler& profiler) {
+    if (!visible || (refreshClock.getElapsedTime().asSeconds() < HUD_REFRESH_SECONDS && !buffer.empty())) {
+        return;
+    }
+    refreshClock.restart();
+
+    char line[96];
+    buffer.clear();
+    buffer += "phase          last    p50    p99 (ms)\n";
+    for (int phase = 0; phase < (int)ProfilePhase::Count; ++phase) {
+        PhaseStats stats = profiler.getPhaseStats((ProfilePhase)phase);
+        std::snprintf(line, sizeof(line), "%-11s %7.2f %6.2f %6.2f\n", getPhaseName((ProfilePhase)phase),
+                      stats.lastMs, stats.p50Ms, stats.p99Ms);
+        buffer += line;
+    }
+    for (int counter = 0; counter < (int)ProfileCounter::Count; ++counter) {
+        std::snprintf(line, sizeof(line), "%-16s %llu\n", getCounterName((ProfileCounter)counter),
+                      (unsigned long long)profiler.getCounter((ProfileCounter)counter));
+        buffer += line;
+    }
+    if (profiler.getDroppedSamples() > 0) {
+        std::snprintf(line, sizeof(line), "dropped samples  %llu\n",
+                      (unsigned long long)profiler.getDroppedSamples());
+        buffer += line;
+    }
+
+    text.setString(buffer);
+    sf::FloatRect bounds = text.getLocalBounds();
+    backdrop.setSize({bounds.position.x + bounds.size.x + 12.f, bounds.position.y + bounds.size.y + 10.f});
+}
+
+// Draws the overlay if visible.
+void ProfilerHud::draw(sf::RenderTarget& target) const {
+    if (!visible) return;
+    target.draw(backdrop);
+    target.draw(text);
+}
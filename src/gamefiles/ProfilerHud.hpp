@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <SFML/Graphics/Font.hpp>           // For sf::Font
+#include <SFML/Graphics/RectangleShape.hpp> // For the backdrop
+#include <SFML/Graphics/RenderTarget.hpp>   // For sf::RenderTarget
+#include <SFML/Graphics/Text.hpp>           // For sf::Text
+#include <SFML/System/Clock.hpp>            // For the refresh interval
+#include "Profiler.hpp"                     // The numbers being shown
+
+// Toggleable overlay with the profiler's rolling p50/p99 per phase and the frame counters.
+// The text is only rebuilt a few times per second, so showing the HUD barely shows up in
+// the numbers it displays, and it costs nothing while hidden.
+struct ProfilerHud {
+    // --- Member Variables ---
+    sf::Text text;                 // One line per phase and counter
+    sf::RectangleShape backdrop;   // Translucent box behind the text
+    sf::Clock refreshClock;        // Time since the text was last rebuilt
+    std::string buffer;            // Reused between refreshes
+    bool visible = false;
+
+    // --- Member Functions (Declarations) ---
+    explicit ProfilerHud(const sf::Font& font);
+
+    void toggle() { visible = !visible; }
+    // Rebuilds the text if visible and the refresh interval has passed.
+    void update(const Profiler& profiler);
+    // Draws the overlay (in screen coordinates) if visible.
+    void draw(sf::RenderTarget& target) const;
+};
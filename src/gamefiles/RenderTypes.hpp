@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// Plain enums shared by the renderer and the tile property table. No SFML here, so the
+// simulation core can name sprites and layers without linking the graphics module.
+
+// Every sprite the game draws. All of them live in one texture so that tiles, pickups and
+// actors can be drawn together in a single draw call.
+enum class SpriteId : std::uint8_t {
+    SolidTile = 0, // Brick wall / floor tile
+    Coin,          // Coin tile
+    Player,        // The player
+    Enemy,         // Enemy entity
+    Pickup,        // Pickup entity (a gem)
+    Spikes,        // Hazard tile
+    Platform,      // One-way platform tile
+    GemTile,       // Gem tile (a coin worth more)
+    Count
+};
+
+// Draw order of the batch, back to front.
+enum class RenderLayer : std::uint8_t {
+    Tiles = 0, // Level geometry (walls, platforms, hazards)
+    Pickups,   // Pickup tiles and entities
+    Actors,    // Enemies and other moving entities
+    Player,    // Always on top of the world
+    Count
+};
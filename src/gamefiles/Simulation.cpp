@@ -0,0 +1,209 @@
+#include "Simulation.hpp" // Include the header definition for Simulation
+#include "Constants.hpp"  // Include global constants
+#include "Profiler.hpp"   // Phase timers (no-ops unless the profiler is enabled)
+#include <algorithm>      // For std::sort, std::min, std::max
+#include <cmath>          // For std::floor
+#include <functional>     // For std::greater
+#include <utility>        // For std::move
+#include <vector>         // For the contact list
+
+// --- Member Function Implementations ---
+
+// Constructor
+Simulation::Simulation(Level startLevel)
+    : level(std::move(startLevel)),
+      entities(),
+      player(entities, level.spawnPoint)
+{
+    for (sf::Vector2f spawn : level.enemySpawns) {
+        entities.create(EntityKind::Enemy, spawn, {ENEMY_HALF_WIDTH, ENEMY_HALF_HEIGHT},
+                        ENTITY_ALIVE | ENTITY_COLLIDES_TILES);
+    }
+}
+
+// Advances the game by exactly one tick using the given input.
+StepEvents Simulation::step(const InputState& input) {
+    StepEvents events;
+
+    // --- Input ---
+    if (input.jump) {
+        player.jump(entities);
+    }
+    player.setHorizontalInput(entities, input.left, input.right);
+
+    // --- Enemy AI ---
+    // Steered before physics, so enemies move with this tick's velocities like the player.
+    if (!level.enemySpawns.empty()) {
+        ScopedTimer timer(ProfilePhase::Ai);
+        navigator.update(level, getStandingTile(entities, player.entity), tick, pathWorker);
+        navigator.steer(entities);
+    }
+
+    // --- Physics (batched over every entity) ---
+    {
+        ScopedTimer timer(ProfilePhase::Physics);
+        applyGravity(entities);
+        resolveTileCollisions(entities, level);
+        events.fellOutOfBounds = player.handleLevelBounds(entities, level);
+        integrate(entities);
+        events.hitHazard = handleHazardTiles(player, entities, level);
+    }
+
+    // --- Pickups and Entity Contacts ---
+    int tileCoins = 0;
+    {
+        ScopedTimer timer(ProfilePhase::Pickups);
+        events.coinsCollected = tileCoins = handleCoinCollection(player, entities, level, eventQueue, tick);
+        spatialHash.rebuild(entities);
+        handleEntityContacts(player, entities, spatialHash, level, events);
+    }
+
+    // --- Events ---
+    // Published without blocking; the consumer (logging, sound) runs outside the tick.
+    if (eventQueue) {
+        sf::Vector2f position = player.getPosition(entities);
+        GameEvent event;
+        event.tick = tick;
+        event.x = static_cast<std::int32_t>(std::floor(position.x / TILE_SIZE));
+        event.y = static_cast<std::int32_t>(std::floor(position.y / TILE_SIZE));
+        event.value = player.score;
+        event.type = GameEventType::CoinCollected;
+        for (int i = tileCoins; i < events.coinsCollected; ++i) {
+            publishEvent(eventQueue, event); // Pickup entities, at the player
+        }
+        if (events.fellOutOfBounds) {
+            event.type = GameEventType::PlayerFellOut;
+            publishEvent(eventQueue, event);
+        }
+        if (events.hitEnemy) {
+            event.type = GameEventType::PlayerHitEnemy;
+            publishEvent(eventQueue, event);
+        }
+        if (events.hitHazard) {
+            event.type = GameEventType::PlayerHitHazard;
+            publishEvent(eventQueue, event);
+        }
+    }
+
+    tick++;
+    return events;
+}
+
+// --- Non-Member Helper Function Implementation ---
+
+// Handles checking for and collecting coins.
+// Modifies both Player and Level state, so it lives next to the step that calls it.
+int handleCoinCollection(Player& player, const EntityStore& entities, Level& level,
+                         GameEventQueue* eventQueue, std::uint64_t tick) {
+    sf::FloatRect playerBounds = player.getBounds(entities);
+    int leftTile = static_cast<int>((playerBounds.position.x + COLLISION_EPSILON) / TILE_SIZE);
+    int rightTile = static_cast<int>((playerBounds.position.x + playerBounds.size.x - COLLISION_EPSILON) / TILE_SIZE);
+    int topTile = static_cast<int>((playerBounds.position.y + COLLISION_EPSILON) / TILE_SIZE);
+    int bottomTile = static_cast<int>((playerBounds.position.y + playerBounds.size.y - COLLISION_EPSILON) / TILE_SIZE);
+
+    // Ask the pickup index first: almost always no chunk under the player holds a coin,
+    // and then no tile needs to be looked at.
+    int leftChunk = std::max(leftTile, 0) / LEVEL_CHUNK_SIZE;
+    int rightChunk = std::min(rightTile, (int)level.size.x - 1) / LEVEL_CHUNK_SIZE;
+    int topChunk = std::max(topTile, 0) / LEVEL_CHUNK_SIZE;
+    int bottomChunk = std::min(bottomTile, (int)level.size.y - 1) / LEVEL_CHUNK_SIZE;
+    bool coinsNearby = false;
+    for (int cy = topChunk; cy <= bottomChunk && !coinsNearby; ++cy) {
+        for (int cx = leftChunk; cx <= rightChunk; ++cx) {
+            if (level.pickups.getCount(cx, cy) > 0) {
+                coinsNearby = true;
+                break;
+            }
+        }
+    }
+    if (!coinsNearby) return 0;
+
+    int collected = 0;
+    for (int y = topTile; y <= bottomTile; ++y) {
+        for (int x = leftTile; x <= rightTile; ++x) {
+            const TileProperties& tile = getTileProperties(level.getTile(x, y));
+            if (tile.flags & TILE_PICKUP) {
+                player.score += tile.score;
+                level.setTile(x, y, TileType::Air); // Remove the pickup
+                collected++;
+                GameEvent event;
+                event.type = GameEventType::CoinCollected;
+                event.tick = tick;
+                event.x = x;
+                event.y = y;
+                event.value = player.score;
+                publishEvent(eventQueue, event);
+            }
+        }
+    }
+    return collected;
+}
+
+// Respawns the player if it overlaps a hazard tile.
+bool handleHazardTiles(Player& player, EntityStore& entities, const Level& level) {
+    sf::FloatRect playerBounds = player.getBounds(entities);
+    int leftTile = static_cast<int>(std::floor((playerBounds.position.x + COLLISION_EPSILON) / TILE_SIZE));
+    int rightTile = static_cast<int>(std::floor((playerBounds.position.x + playerBounds.size.x - COLLISION_EPSILON) / TILE_SIZE));
+    int topTile = static_cast<int>(std::floor((playerBounds.position.y + COLLISION_EPSILON) / TILE_SIZE));
+    int bottomTile = static_cast<int>(std::floor((playerBounds.position.y + playerBounds.size.y - COLLISION_EPSILON) / TILE_SIZE));
+    if (!anyTileHas<TILE_HAZARD>(level, leftTile, topTile, rightTile, bottomTile)) return false;
+
+    entities.setPosition(player.entity, level.spawnPoint);
+    entities.setVelocity(player.entity, {0.f, 0.f});
+    entities.setFlag(player.entity, ENTITY_ON_GROUND, false);
+    return true;
+}
+
+// Resolves the player touching other entities using the spatial hash.
+void handleEntityContacts(Player& player, EntityStore& entities, const SpatialHash& spatialHash,
+                          const Level& level, StepEvents& events) {
+    std::vector<std::size_t> contacts;
+    spatialHash.queryAabb(player.getBounds(entities), contacts);
+
+    std::vector<std::size_t> collected;
+    for (std::size_t other : contacts) {
+        if (other == player.entity) continue;
+        switch (entities.kinds[other]) {
+            case EntityKind::Pickup:
+                player.score++;
+                events.coinsCollected++;
+                collected.push_back(other);
+                break;
+            case EntityKind::Enemy:
+                events.hitEnemy = true;
+                break;
+            default:
+                break;
+        }
+    }
+    if (events.hitEnemy) {
+        entities.setPosition(player.entity, level.spawnPoint);
+        entities.setVelocity(player.entity, {0.f, 0.f});
+        entities.setFlag(player.entity, ENTITY_ON_GROUND, false);
+    }
+    // Remove highest index first so swap-removal never moves an entity still to be removed.
+    std::sort(collected.begin(), collected.end(), std::greater<std::size_t>());
+    for (std::size_t index : collected) {
+        entities.remove(index);
+    }
+}
+
+// Input and physics for several players, as in Simulation::step.
+void stepPlayers(Player* const* players, const InputState* inputs, std::size_t count,
+                 EntityStore& entities, const Level& level) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (inputs[i].jump) {
+            players[i]->jump(entities);
+        }
+        players[i]->setHorizontalInput(entities, inputs[i].left, inputs[i].right);
+    }
+    applyGravity(entities);
+    resolveTileCollisions(entities, level);
+    for (std::size_t i = 0; i < count; ++i) {
+        players[i]->handleLevelBounds(entities, level);
+    }
+    integrate(entities);
+    for (std::size_t i = 0; i < count; ++i) {
+        handleHazardTiles(*players[i], entities, level);
+    }
+}
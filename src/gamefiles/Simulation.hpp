@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include "Level.hpp"  // Level is stored by value
+#include "Player.hpp" // Player is stored by value
+#include "EntityStore.hpp" // Every moving body, including the player's
+#include "SpatialHash.hpp" // Broad phase for entity-vs-entity contacts
+#include "GameEvents.hpp"  // Events published for the presentation side
+#include "Pathfinding.hpp" // Flow fields steering the enemies
+
+// Player input for a single simulation tick.
+struct InputState {
+    bool left = false;  // Move left held
+    bool right = false; // Move right held
+    bool jump = false;  // Jump pressed since the previous tick
+};
+
+// What happened during a single simulation tick, for the caller to report.
+struct StepEvents {
+    int coinsCollected = 0;       // Pickups (tiles and entities) picked up this tick
+    bool fellOutOfBounds = false; // Player fell out and was respawned
+    bool hitEnemy = false;        // Player touched an enemy and was respawned
+    bool hitHazard = false;       // Player touched a hazard tile and was respawned
+};
+
+// The complete game state, advanced one fixed tick (SIM_TICK_SECONDS) at a time.
+// Has no dependency on a window, so it can run headless at any tick rate.
+struct Simulation {
+    // --- Member Variables ---
+    Level level;             // Current level, including collected coins
+    EntityStore entities;    // Bodies of the player and every other actor
+    Player player;           // The player character (its body is in 'entities')
+    SpatialHash spatialHash; // Entity broad phase, rebuilt after movement every tick
+    std::uint64_t tick = 0;  // Number of steps taken so far
+    GameEventQueue* eventQueue = nullptr; // Optional, not owned: receives a GameEvent per
+                                          // pickup, fall and enemy hit. The caller drains it.
+    EnemyNavigator navigator;             // Flow field towards the player, for the enemies
+    FlowFieldWorker* pathWorker = nullptr; // Optional, not owned: computes flow fields on its
+                                           // own thread. Without one they are computed inline;
+                                           // the enemies behave the same either way.
+
+    // --- Member Functions (Declarations) ---
+    // Starts a simulation with the player at the level's spawn point and an enemy at each
+    // of the level's enemy spawns.
+    explicit Simulation(Level startLevel);
+
+    // Advances the game by exactly one tick using the given input.
+    StepEvents step(const InputState& input);
+};
+
+// --- Non-Member Helper Functions (Declarations) ---
+// Collects every pickup tile (coin, gem) the player overlaps, adding its score and
+// publishing a CoinCollected event for each to 'eventQueue' (may be null). Returns the
+// number of tiles collected.
+int handleCoinCollection(Player& player, const EntityStore& entities, Level& level,
+                         GameEventQueue* eventQueue = nullptr, std::uint64_t tick = 0);
+// Respawns the player at the level's spawn point if it overlaps a TILE_HAZARD tile.
+// Returns true if it did.
+bool handleHazardTiles(Player& player, EntityStore& entities, const Level& level);
+// Resolves the player touching other entities (pickups are collected, enemies respawn the
+// player) using the spatial hash built from 'entities'. Fills in the matching 'events'.
+void handleEntityContacts(Player& player, EntityStore& entities, const SpatialHash& spatialHash,
+                          const Level& level, StepEvents& events);
+// Runs the input and physics part of a tick for 'count' players whose bodies are in
+// 'entities', in the same order as Simulation::step (no enemies, pickups or events).
+// Multiplayer rooms step their players with it, and clients predict their own with it.
+void stepPlayers(Player* const* players, const InputState* inputs, std::size_t count,
+                 EntityStore& entities, const Level& level);
@@ -0,0 +1,212 @@
+#include "SimulationThread.hpp" // Include the header definition for SimulationThread
+#include "Constants.hpp"        // SIM_TICK_SECONDS, MAX_FRAME_SECONDS
+#include <algorithm>            // For std::min, std::remove_if
+#include <chrono>               // For the tick clock
+
+// --- Member Function Implementations ---
+
+// Constructor
+SimulationThread::SimulationThread(Simulation& sim)
+    : sim(sim)
+{
+}
+
+// Destructor: never leave the thread running on a destroyed Simulation.
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+// Publishes a first snapshot (so the renderer has something to draw) and starts ticking.
+void SimulationThread::start() {
+    sim.level.recordTileChanges = true;
+    rewindBuffer.reset(sim);
+    sf::Vector2f position = sim.player.getPosition(sim.entities);
+    publishSnapshot(position, false);
+    stopRequested.store(false, std::memory_order_relaxed);
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+// Stops ticking and joins the thread.
+void SimulationThread::stop() {
+    stopRequested.store(true, std::memory_order_release);
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// The newest snapshot.
+const RenderSnapshot& SimulationThread::acquireSnapshot() {
+    snapshots.acquire();
+    return snapshots.getReadBuffer();
+}
+
+// The simulation thread: the same fixed-timestep accumulator main() used to run, with
+// the frame time replaced by the time since the thread last woke up.
+void SimulationThread::run() {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point previous = Clock::now();
+    double accumulator = 0.0;
+    bool pendingJump = false;
+    bool finished = false;
+    const bool timeControl = !recordLog && !replayLog; // Quicksave, quickload and rewind allowed?
+
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        Clock::time_point now = Clock::now();
+        accumulator += std::min(std::chrono::duration<double>(now - previous).count(), (double)MAX_FRAME_SECONDS);
+        previous = now;
+
+        // Keys held in the newest command; a jump pressed in any of them is kept for the next tick.
+        InputCommand command;
+        bool saveRequested = false, loadRequested = false;
+        while (inputs.pop(command)) {
+            heldInput = command;
+            pendingJump = pendingJump || command.jump;
+            saveRequested = saveRequested || command.quickSave;
+            loadRequested = loadRequested || command.quickLoad;
+        }
+        bool loaded = false;
+        if (timeControl && saveRequested) {
+            quickSave();
+        }
+        if (timeControl && loadRequested) {
+            quickLoad();
+            loaded = true; // Publish now, even if no tick is due
+        }
+
+        // A streamed level may not have the player's chunk yet; hold the simulation rather
+        // than let the player fall through tiles that haven't arrived.
+        sf::Vector2f playerPosition = sim.player.getPosition(sim.entities);
+        sim.level.streamAround(playerPosition, heldInput.viewHalfExtent);
+        if (!sim.level.isLoadedAt(playerPosition)) {
+            accumulator = 0.0;
+        }
+
+        bool ticked = loaded;
+        sf::Vector2f previousPlayerPosition = playerPosition;
+        while (accumulator >= SIM_TICK_SECONDS && !finished) {
+            if (timeControl && heldInput.rewind) {
+                // Undo one tick per tick; stays put once the history runs out.
+                pendingJump = false;
+                previousPlayerPosition = sim.player.getPosition(sim.entities);
+                if (rewindBuffer.stepBack(sim)) {
+                    serial++;
+                    collectTileChanges();
+                    ticked = true;
+                }
+                accumulator -= SIM_TICK_SECONDS;
+                continue;
+            }
+
+            InputState input;
+            input.left = heldInput.left;
+            input.right = heldInput.right;
+            input.jump = pendingJump;
+            pendingJump = false;
+            if (replayLog && !replayCursor.next(*replayLog, input)) {
+                finished = true; // The recording is over; the main thread checks the result
+                ticked = true;   // Publish once more so the renderer sees 'finished'
+                break;
+            }
+            if (recordLog) {
+                recordLog->append(input);
+            }
+
+            previousPlayerPosition = sim.player.getPosition(sim.entities);
+            StepEvents events = sim.step(input);
+            if (events.fellOutOfBounds || events.hitEnemy || events.hitHazard) {
+                previousPlayerPosition = sim.player.getPosition(sim.entities); // Don't interpolate across the respawn
+            }
+            if (timeControl) {
+                rewindBuffer.record(sim, sim.level.tileChanges);
+            }
+            serial++;
+            collectTileChanges();
+            ticked = true;
+            accumulator -= SIM_TICK_SECONDS;
+        }
+        if (ticked) {
+            publishSnapshot(previousPlayerPosition, finished);
+        }
+
+        // Sleep until the next tick is due.
+        double untilNextTick = finished ? SIM_TICK_SECONDS : std::max(0.0, SIM_TICK_SECONDS - accumulator);
+        std::this_thread::sleep_for(std::chrono::duration<double>(untilNextTick));
+    }
+}
+
+// Moves the level's new tile changes into pendingChanges and drops acknowledged ones.
+void SimulationThread::collectTileChanges() {
+    std::uint64_t acknowledged = acknowledgedSerial.load(std::memory_order_acquire);
+    if (!pendingChanges.empty() && pendingChanges.front().serial <= acknowledged) {
+        pendingChanges.erase(std::remove_if(pendingChanges.begin(), pendingChanges.end(),
+                                            [&](const TimedTileChange& change) { return change.serial <= acknowledged; }),
+                             pendingChanges.end());
+    }
+    for (const TileChange& change : sim.level.tileChanges) {
+        pendingChanges.push_back({serial, change});
+    }
+    sim.level.tileChanges.clear();
+}
+
+// Saves the state into savedState, sharing the tile chunks that did not change since
+// the last save.
+void SimulationThread::quickSave() {
+    GameEvent event;
+    event.type = GameEventType::QuickSaved;
+    event.tick = sim.tick;
+    event.value = snapshotStore.capture(sim, savedState) ? 0 : -1;
+    publishEvent(sim.eventQueue, event);
+}
+
+// Loads savedState, if there is one. The rewind history starts over from there.
+void SimulationThread::quickLoad() {
+    GameEvent event;
+    event.type = GameEventType::QuickLoaded;
+    event.value = -1;
+    if (savedState.isValid() && snapshotStore.restore(savedState, sim)) {
+        rewindBuffer.reset(sim);
+        serial++;
+        collectTileChanges();
+        event.value = 0;
+    }
+    event.tick = sim.tick;
+    publishEvent(sim.eventQueue, event);
+}
+
+// Fills the write buffer from the simulation and publishes it.
+void SimulationThread::publishSnapshot(sf::Vector2f previousPlayerPosition, bool finished) {
+    RenderSnapshot& snapshot = snapshots.getWriteBuffer();
+    snapshot.tick = sim.tick;
+    snapshot.serial = serial;
+    snapshot.publishTime = std::chrono::steady_clock::now();
+    snapshot.previousPlayerPosition = previousPlayerPosition;
+    snapshot.playerPosition = sim.player.getPosition(sim.entities);
+    snapshot.playerEntity = sim.player.entity;
+    snapshot.entities = sim.entities; // Reuses the buffer's capacity
+    snapshot.score = sim.player.score;
+    snapshot.remainingCoins = sim.level.getRemainingCoins();
+    snapshot.finished = finished;
+    snapshot.tileChanges = pendingChanges;
+    snapshots.publish();
+}
+
+// Applies the changes newer than appliedSerial, retrying deferred ones first.
+void LevelMirror::apply(const RenderSnapshot& snapshot) {
+    // setTile fails on a streamed level whose chunk hasn't arrived; keep those for later.
+    std::size_t kept = 0;
+    for (const TileChange& change : deferred) {
+        if (!level.setTile(change.x, change.y, change.type)) {
+            deferred[kept++] = change;
+        }
+    }
+    deferred.resize(kept);
+
+    for (const TimedTileChange& timed : snapshot.tileChanges) {
+        if (timed.serial <= appliedSerial) continue; // Already applied from an earlier snapshot
+        const TileChange& change = timed.change;
+        if (!level.setTile(change.x, change.y, change.type)) {
+            deferred.push_back(change);
+        }
+    }
+    appliedSerial = std::max(appliedSerial, snapshot.serial);
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <SFML/System/Vector2.hpp> // For positions
+#include "Simulation.hpp"          // The state being advanced
+#include "EntityStore.hpp"         // Copied into snapshots for drawing
+#include "InputLog.hpp"            // Recording and replay happen on the simulation thread
+#include "SpscQueue.hpp"           // Input from the main thread
+#include "TripleBuffer.hpp"        // Snapshots to the main thread
+#include "WorldSnapshot.hpp"       // Quicksave and rewind
+
+// Input sampled by the main thread once per frame.
+struct InputCommand {
+    bool left = false;            // Held state
+    bool right = false;
+    bool jump = false;            // Pressed since the previous command
+    bool quickSave = false;       // Pressed since the previous command
+    bool quickLoad = false;
+    bool rewind = false;          // Held: run time backwards, one tick per tick
+    sf::Vector2f viewHalfExtent;  // Camera half size (pixels): how far around the player
+                                  // a streamed level must be loaded
+};
+
+// A tile change tagged with the serial of the tick (or rewind step) that made it.
+struct TimedTileChange {
+    std::uint64_t serial = 0;
+    TileChange change;
+};
+
+// Everything the renderer needs from one simulation tick. Immutable once published.
+struct RenderSnapshot {
+    std::uint64_t tick = 0;                 // Simulation::tick after the last step
+    std::uint64_t serial = 0;               // Ticks run, rewound or loaded since start();
+                                            // unlike 'tick', never goes backwards
+    std::chrono::steady_clock::time_point publishTime; // When published, for interpolation
+    sf::Vector2f previousPlayerPosition;    // Before the last tick (== current after a respawn)
+    sf::Vector2f playerPosition;            // After the last tick
+    std::size_t playerEntity = 0;           // Index of the player in 'entities'
+    EntityStore entities;                   // Every body, as of 'tick'
+    int score = 0;                          // HUD values
+    std::size_t remainingCoins = 0;
+    bool finished = false;                  // A replay has run out of input
+    // Every tile change the renderer has not acknowledged yet, oldest first. A change can
+    // appear in several snapshots; applying it again is harmless.
+    std::vector<TimedTileChange> tileChanges;
+};
+
+// Runs a Simulation at the fixed tick rate on its own thread (stage one of the frame
+// pipeline), while the main thread renders (stage two). The main thread sends input
+// through a lock-free SPSC queue and reads the newest RenderSnapshot from a triple
+// buffer, so neither stage ever blocks on the other.
+//
+// The renderer keeps its own copy of the level and brings it up to date with a
+// LevelMirror. While running, the Simulation must not be touched by any other
+// thread; after stop() it is safe to read again (e.g. for captureFingerprint()).
+//
+// Quicksave, quickload and rewind requests arrive with the input and are carried out
+// between ticks. They are ignored while recording or replaying, where they would make
+// the recording impossible to replay.
+class SimulationThread {
+public:
+    explicit SimulationThread(Simulation& sim);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // --- Before start() ---
+    // Appends every tick's input to 'log'.
+    void setRecording(InputLog* log) { recordLog = log; }
+    // Takes input from 'log' instead of the queue; stops ticking when it runs out.
+    void setReplay(const InputLog* log) { replayLog = log; }
+
+    // Publishes a first snapshot and starts ticking.
+    void start();
+    // Stops ticking and joins the thread. Safe to call more than once.
+    void stop();
+
+    // --- Main Thread ---
+    // Queues this frame's input. Returns false (dropping it) if the simulation is far behind.
+    bool pushInput(const InputCommand& command) { return inputs.push(command); }
+    // The newest snapshot (the same one again if no tick finished since the last call).
+    const RenderSnapshot& acquireSnapshot();
+    // Tells the simulation thread every tile change up to 'serial' has been applied.
+    void acknowledge(std::uint64_t serial) { acknowledgedSerial.store(serial, std::memory_order_release); }
+
+private:
+    void run();
+    // Moves the level's new tile changes into pendingChanges, tagged with 'serial', and
+    // drops acknowledged ones.
+    void collectTileChanges();
+    // Quicksave/quickload requests; both publish a GameEvent.
+    void quickSave();
+    void quickLoad();
+    void publishSnapshot(sf::Vector2f previousPlayerPosition, bool finished);
+
+    Simulation& sim;
+    std::thread thread;
+    std::atomic<bool> stopRequested{false};
+
+    SpscQueue<InputCommand, 256> inputs;
+    TripleBuffer<RenderSnapshot> snapshots;
+    std::atomic<std::uint64_t> acknowledgedSerial{0};
+
+    // Simulation thread only.
+    std::vector<TimedTileChange> pendingChanges; // Not yet acknowledged, oldest first
+    InputCommand heldInput;                      // Latest command (for held keys)
+    InputLog* recordLog = nullptr;
+    const InputLog* replayLog = nullptr;
+    InputLogCursor replayCursor;
+    std::uint64_t serial = 0;                    // See RenderSnapshot::serial
+    SnapshotStore snapshotStore;                 // Shares tile chunks between save states
+    WorldSnapshot savedState;                    // The quicksave
+    RewindBuffer rewindBuffer{REWIND_TICKS};     // The last REWIND_TICKS ticks, for rewinding
+};
+
+// The renderer's copy of the level, kept in step with the simulation's through the tile
+// changes in each snapshot.
+struct LevelMirror {
+    // --- Member Variables ---
+    Level level;                        // Loaded the same way as the simulation's level
+    std::uint64_t appliedSerial = 0;    // Changes up to this serial are applied
+    std::vector<TileChange> deferred;   // Streamed levels: changes to chunks not loaded yet
+
+    // --- Member Functions (Declarations) ---
+    // Applies the changes of 'snapshot' newer than appliedSerial, retrying deferred ones first.
+    void apply(const RenderSnapshot& snapshot);
+};
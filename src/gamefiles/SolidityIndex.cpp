@@ -0,0 +1,53 @@
+#include "SolidityIndex.hpp" // Include the header definition for SolidityIndex
+#include "Constants.hpp"     // LEVEL_CHUNK_SIZE, for the pickup counts
+
+// --- Member Function Implementations ---
+
+// Empties the index.
+void SolidityIndex::clear() {
+    rowSolid.clear();
+    rowOneWay.clear();
+    columnSolid.clear();
+    columnOneWay.clear();
+    width = height = 0;
+    rowWords = columnWords = 0;
+    built = false;
+}
+
+// Indexes every tile of 'tiles' and counts its pickups, one pass in memory order.
+void SolidityIndex::build(const TileGrid& tiles, PickupIndex& pickups) {
+    width = tiles.width;
+    height = tiles.height;
+    rowWords = (width + 63) / 64;
+    columnWords = (height + 63) / 64;
+    rowSolid.assign(rowWords * height, 0);
+    rowOneWay.assign(rowWords * height, 0);
+    columnSolid.assign(columnWords * width, 0);
+    columnOneWay.assign(columnWords * width, 0);
+    for (unsigned int y = 0; y < height; ++y) {
+        const TileType* row = tiles.data + static_cast<std::size_t>(y) * width;
+        for (unsigned int x = 0; x < width; ++x) {
+            std::uint8_t flags = getTileFlags(row[x]);
+            if (!flags) continue; // Air and other plain tiles: the common case
+            if (flags & (TILE_SOLID | TILE_ONE_WAY)) {
+                update((int)x, (int)y, row[x]);
+            }
+            if (flags & TILE_PICKUP) {
+                pickups.add(x / LEVEL_CHUNK_SIZE, y / LEVEL_CHUNK_SIZE, 1);
+            }
+        }
+    }
+    built = true;
+}
+
+// Updates the bits of tile (x, y).
+void SolidityIndex::update(int x, int y, TileType type) {
+    std::uint8_t flags = getTileFlags(type);
+    std::uint64_t rowBit = 1ull << (x & 63), columnBit = 1ull << (y & 63);
+    std::size_t rowWord = y * rowWords + (x >> 6), columnWord = x * columnWords + (y >> 6);
+    auto assign = [](std::uint64_t& word, std::uint64_t bit, bool set) { word = set ? word | bit : word & ~bit; };
+    assign(rowSolid[rowWord], rowBit, flags & TILE_SOLID);
+    assign(columnSolid[columnWord], columnBit, flags & TILE_SOLID);
+    assign(rowOneWay[rowWord], rowBit, flags & TILE_ONE_WAY);
+    assign(columnOneWay[columnWord], columnBit, flags & TILE_ONE_WAY);
+}
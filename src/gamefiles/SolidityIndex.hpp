@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm> // For std::clamp, std::min, std::max
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PickupIndex.hpp"    // Counted in the same pass as the index is built
+#include "TileGrid.hpp"       // TileType, the grid the index is built from
+#include "TileProperties.hpp" // TILE_SOLID, TILE_ONE_WAY
+
+// Bitset index of which tiles block movement: one bit per tile, in bit planes per row and
+// per column for solid and for one-way tiles, kept up to date by Level::setTile. Answers
+// "is any tile in this span blocking" and "where is the first blocking tile along this
+// row/column" 64 tiles at a time with bit scans instead of one tile lookup per tile.
+// Costs 4 bits per tile.
+//
+// Only built for levels held fully in memory; streamed levels leave it empty and their
+// queries fall back to getTile() loops.
+struct SolidityIndex {
+    // --- Member Variables ---
+    std::vector<std::uint64_t> rowSolid;     // Row y, column x: bit x % 64 of word y * rowWords + x / 64
+    std::vector<std::uint64_t> rowOneWay;    // Same layout, TILE_ONE_WAY tiles
+    std::vector<std::uint64_t> columnSolid;  // Column x, row y: bit y % 64 of word x * columnWords + y / 64
+    std::vector<std::uint64_t> columnOneWay; // Same layout, TILE_ONE_WAY tiles
+    unsigned int width = 0;                  // Level size in tiles
+    unsigned int height = 0;
+    std::size_t rowWords = 0;                // Words per row / per column
+    std::size_t columnWords = 0;
+    bool built = false;                      // False for streamed (or not yet loaded) levels
+
+    // --- Member Functions (Declarations) ---
+    // Empties the index; queries must then go through the tiles.
+    void clear();
+    // Indexes every tile of 'tiles' and counts its pickups into 'pickups' (reset to the
+    // level's chunks by the caller) in the same pass, so a load reads the grid only once.
+    void build(const TileGrid& tiles, PickupIndex& pickups);
+    // Updates the bits of tile (x, y), which is now 'type'. (x, y) must be inside the level.
+    void update(int x, int y, TileType type);
+
+    // --- Queries ---
+    // 'mask' is TILE_SOLID, TILE_ONE_WAY or both. Tiles outside the level count as Air.
+    // Defined inline: the collision resolvers call them several times per body per tick.
+
+    // Column of the first tile with a flag in 'mask' in row 'y', scanning from 'fromX'
+    // towards 'toX' (inclusive, either direction). Returns -1 if there is none.
+    int findInRow(int y, int fromX, int toX, std::uint8_t mask) const {
+        if (y < 0 || y >= (int)height || !clampScan(fromX, toX, width)) return -1;
+        std::size_t offset = y * rowWords;
+        return findBit(mask & TILE_SOLID ? &rowSolid[offset] : nullptr,
+                       mask & TILE_ONE_WAY ? &rowOneWay[offset] : nullptr, fromX, toX);
+    }
+    // Row of the first tile with a flag in 'mask' in column 'x', scanning from 'fromY'
+    // towards 'toY' (inclusive, either direction). Returns -1 if there is none.
+    int findInColumn(int x, int fromY, int toY, std::uint8_t mask) const {
+        if (x < 0 || x >= (int)width || !clampScan(fromY, toY, height)) return -1;
+        std::size_t offset = x * columnWords;
+        return findBit(mask & TILE_SOLID ? &columnSolid[offset] : nullptr,
+                       mask & TILE_ONE_WAY ? &columnOneWay[offset] : nullptr, fromY, toY);
+    }
+    // Does any tile in columns x0..x1, rows y0..y1 (inclusive) have a flag in 'mask'?
+    // Scans along whichever side of the area is longer.
+    bool anyInArea(int x0, int y0, int x1, int y1, std::uint8_t mask) const {
+        if (x0 > x1) std::swap(x0, x1);
+        if (y0 > y1) std::swap(y0, y1);
+        x0 = std::max(x0, 0);
+        y0 = std::max(y0, 0);
+        x1 = std::min(x1, (int)width - 1);
+        y1 = std::min(y1, (int)height - 1);
+        if (y1 - y0 > x1 - x0) {
+            for (int x = x0; x <= x1; ++x) {
+                if (findInColumn(x, y0, y1, mask) >= 0) return true;
+            }
+        } else {
+            for (int y = y0; y <= y1; ++y) {
+                if (findInRow(y, x0, x1, mask) >= 0) return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    // Clamps the scan from..to to 0..limit - 1, keeping its direction. Returns false if the
+    // scan lies entirely outside.
+    static bool clampScan(int& from, int& to, unsigned int limit) {
+        if (std::max(from, to) < 0 || std::min(from, to) >= (int)limit) return false;
+        from = std::clamp(from, 0, (int)limit - 1);
+        to = std::clamp(to, 0, (int)limit - 1);
+        return true;
+    }
+
+    // Index of the lowest / highest set bit of a non-zero word.
+    static int lowestBit(std::uint64_t word) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return (int)index;
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+    static int highestBit(std::uint64_t word) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, word);
+        return (int)index;
+#else
+        return 63 - __builtin_clzll(word);
+#endif
+    }
+
+    // First set bit of the two planes combined (either may be null), scanning from 'from'
+    // towards 'to' (inclusive, both inside the plane), or -1.
+    static int findBit(const std::uint64_t* solid, const std::uint64_t* oneWay, int from, int to) {
+        auto wordAt = [&](int i) { return (solid ? solid[i] : 0) | (oneWay ? oneWay[i] : 0); };
+        int fromWord = from >> 6, toWord = to >> 6;
+        if (from <= to) {
+            std::uint64_t word = wordAt(fromWord) & (~0ull << (from & 63));
+            for (int i = fromWord;; word = wordAt(++i)) {
+                if (i == toWord) word &= ~0ull >> (63 - (to & 63));
+                if (word) return i * 64 + lowestBit(word);
+                if (i == toWord) return -1;
+            }
+        } else {
+            std::uint64_t word = wordAt(fromWord) & (~0ull >> (63 - (from & 63)));
+            for (int i = fromWord;; word = wordAt(--i)) {
+                if (i == toWord) word &= ~0ull << (to & 63);
+                if (word) return i * 64 + highestBit(word);
+                if (i == toWord) return -1;
+            }
+        }
+    }
+};
@@ -0,0 +1,132 @@
+#include "SpatialHash.hpp" // Include the header definition for SpatialHash
+#include "EntityStore.hpp" // Include the full definition of EntityStore
+#include "Constants.hpp"   // Include global constants like TILE_SIZE
+#include <algorithm>       // For std::max, std::min
+#include <cmath>           // For std::floor
+
+// --- Helpers ---
+
+namespace {
+
+int cellIndex(float pixel) {
+    return static_cast<int>(std::floor(pixel / TILE_SIZE));
+}
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Rebuilds the hash from every ENTITY_ALIVE entity in 'entities'.
+void SpatialHash::rebuild(const EntityStore& entities) {
+    const std::size_t count = entities.size();
+
+    // About two buckets per entity keeps most buckets to a single cell.
+    std::size_t bucketCount = 16;
+    while (bucketCount < count * 2) bucketCount *= 2;
+    bucketMask = bucketCount - 1;
+    bucketStart.assign(bucketCount + 1, 0);
+    entryBucket.resize(count);
+    maxHalfExtent = {0.f, 0.f};
+
+    // --- Pass 1: count entities per bucket ---
+    std::size_t alive = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!(entities.flags[i] & ENTITY_ALIVE)) {
+            entryBucket[i] = (std::uint32_t)bucketCount; // Marker: skipped
+            continue;
+        }
+        std::uint32_t bucket = (std::uint32_t)bucketOf(cellIndex(entities.posX[i]), cellIndex(entities.posY[i]));
+        entryBucket[i] = bucket;
+        bucketStart[bucket + 1]++;
+        maxHalfExtent.x = std::max(maxHalfExtent.x, entities.halfW[i]);
+        maxHalfExtent.y = std::max(maxHalfExtent.y, entities.halfH[i]);
+        alive++;
+    }
+
+    // --- Pass 2: prefix sum gives each bucket its range ---
+    for (std::size_t b = 0; b < bucketCount; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    // --- Pass 3: scatter entries into their ranges ---
+    entries.resize(alive);
+    bucketCursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t bucket = entryBucket[i];
+        if (bucket == bucketCount) continue;
+        Entry& entry = entries[bucketCursor[bucket]++];
+        entry.minX = entities.posX[i] - entities.halfW[i];
+        entry.minY = entities.posY[i] - entities.halfH[i];
+        entry.maxX = entities.posX[i] + entities.halfW[i];
+        entry.maxY = entities.posY[i] + entities.halfH[i];
+        entry.cellX = cellIndex(entities.posX[i]);
+        entry.cellY = cellIndex(entities.posY[i]);
+        entry.entity = (std::uint32_t)i;
+    }
+}
+
+// Calls 'visit' for every entry in the cells overlapping 'area' (widened by maxHalfExtent).
+template <typename Visitor>
+void SpatialHash::forEachCandidate(const sf::FloatRect& area, Visitor&& visit) const {
+    if (entries.empty()) return;
+    int minCellX = cellIndex(area.position.x - maxHalfExtent.x);
+    int minCellY = cellIndex(area.position.y - maxHalfExtent.y);
+    int maxCellX = cellIndex(area.position.x + area.size.x + maxHalfExtent.x);
+    int maxCellY = cellIndex(area.position.y + area.size.y + maxHalfExtent.y);
+
+    // A query area covering more cells than there are buckets would visit buckets twice;
+    // scanning every entry once is both correct and cheaper then.
+    std::size_t cellCount = (std::size_t)(maxCellX - minCellX + 1) * (std::size_t)(maxCellY - minCellY + 1);
+    if (cellCount > bucketMask) {
+        for (const Entry& entry : entries) visit(entry);
+        return;
+    }
+    for (int cy = minCellY; cy <= maxCellY; ++cy) {
+        for (int cx = minCellX; cx <= maxCellX; ++cx) {
+            std::size_t bucket = bucketOf(cx, cy);
+            for (std::uint32_t e = bucketStart[bucket]; e < bucketStart[bucket + 1]; ++e) {
+                const Entry& entry = entries[e];
+                // Buckets can hold other cells that hash alike; only take this cell's entries.
+                if (entry.cellX == cx && entry.cellY == cy) visit(entry);
+            }
+        }
+    }
+}
+
+// Appends the indices of entities whose boxes overlap 'area' to 'out'.
+void SpatialHash::queryAabb(const sf::FloatRect& area, std::vector<std::size_t>& out) const {
+    float maxX = area.position.x + area.size.x;
+    float maxY = area.position.y + area.size.y;
+    forEachCandidate(area, [&](const Entry& entry) {
+        if (entry.minX < maxX && entry.maxX > area.position.x && entry.minY < maxY && entry.maxY > area.position.y) {
+            out.push_back(entry.entity);
+        }
+    });
+}
+
+// Appends the indices of entities whose boxes come within 'radius' of 'center' to 'out'.
+void SpatialHash::queryRadius(sf::Vector2f center, float radius, std::vector<std::size_t>& out) const {
+    sf::FloatRect area({center.x - radius, center.y - radius}, {radius * 2.f, radius * 2.f});
+    float radiusSquared = radius * radius;
+    forEachCandidate(area, [&](const Entry& entry) {
+        // Distance from the circle center to the closest point of the box.
+        float dx = center.x - std::clamp(center.x, entry.minX, entry.maxX);
+        float dy = center.y - std::clamp(center.y, entry.minY, entry.maxY);
+        if (dx * dx + dy * dy <= radiusSquared) {
+            out.push_back(entry.entity);
+        }
+    });
+}
+
+// Appends every pair (a, b), a < b, of entities whose boxes overlap to 'out'.
+void SpatialHash::findOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const {
+    for (const Entry& self : entries) {
+        sf::FloatRect area({self.minX, self.minY}, {self.maxX - self.minX, self.maxY - self.minY});
+        forEachCandidate(area, [&](const Entry& other) {
+            if (other.entity > self.entity && other.minX < self.maxX && other.maxX > self.minX &&
+                other.minY < self.maxY && other.maxY > self.minY) {
+                out.push_back({self.entity, other.entity});
+            }
+        });
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>  // For sf::FloatRect (header-only)
+#include <SFML/System/Vector2.hpp> // For sf::Vector2f
+
+struct EntityStore;
+
+// Broad phase for entity-vs-entity queries: a uniform grid of TILE_SIZE cells, hashed into
+// a flat bucket table so the world can be any size.
+//
+// rebuild() is O(n) (a counting sort of entities by bucket) and is meant to run once per
+// tick after the entities moved. Each entity is stored once, in the cell holding its center,
+// together with a copy of its bounding box; queries widen their area by the largest half
+// extent seen so entities overhanging into neighbouring cells are still found, then test
+// the exact boxes. Queries don't modify the hash, so any number of threads may run them at
+// once between rebuilds.
+class SpatialHash {
+public:
+    // Rebuilds the hash from every ENTITY_ALIVE entity in 'entities'.
+    void rebuild(const EntityStore& entities);
+
+    // Appends the indices of entities whose boxes overlap 'area' to 'out'.
+    void queryAabb(const sf::FloatRect& area, std::vector<std::size_t>& out) const;
+    // Appends the indices of entities whose boxes come within 'radius' of 'center' to 'out'.
+    void queryRadius(sf::Vector2f center, float radius, std::vector<std::size_t>& out) const;
+    // Appends every pair (a, b), a < b, of entities whose boxes overlap to 'out'.
+    void findOverlappingPairs(std::vector<std::pair<std::size_t, std::size_t>>& out) const;
+
+    std::size_t getEntryCount() const { return entries.size(); }
+
+private:
+    // An entity's bounding box, stored by bucket so queries read contiguous memory.
+    struct Entry {
+        float minX, minY, maxX, maxY;
+        int cellX, cellY;      // Cell holding the center, to skip other cells sharing the bucket
+        std::uint32_t entity;
+    };
+
+    std::size_t bucketOf(int cellX, int cellY) const {
+        // Two large primes spread neighbouring cells over the table.
+        std::uint32_t hash = (std::uint32_t)cellX * 73856093u ^ (std::uint32_t)cellY * 19349663u;
+        return hash & bucketMask;
+    }
+    // Calls 'visit' for every entry in the cells overlapping 'area' (widened by maxHalfExtent).
+    template <typename Visitor>
+    void forEachCandidate(const sf::FloatRect& area, Visitor&& visit) const;
+
+    std::vector<std::uint32_t> bucketStart; // Entries of bucket b are [bucketStart[b], bucketStart[b + 1])
+    std::vector<Entry> entries;             // Sorted by bucket
+    std::vector<std::uint32_t> entryBucket;  // Scratch for rebuild(): bucket of each entity
+    std::vector<std::uint32_t> bucketCursor; // Scratch for rebuild(): next free slot per bucket
+    std::size_t bucketMask = 0;             // Bucket count - 1 (count is a power of two)
+    sf::Vector2f maxHalfExtent;             // Largest half size of any entity in the hash
+};
@@ -0,0 +1,237 @@
+#include "SpriteAtlas.hpp" // Include the header definition for SpriteAtlas
+#include "Constants.hpp"   // For TILE_SIZE
+#include <algorithm>       // For std::sort, std::max
+#include <cmath>           // For std::abs
+#include <filesystem>      // For checking which art files exist
+#include <iostream>        // For std::cerr
+#include <vector>          // For the packing order
+
+namespace {
+
+const unsigned int ATLAS_WIDTH = 256; // Shelf width; the height grows to fit
+const unsigned int SPRITE_BORDER = 1; // Extruded edge pixels around every sprite
+
+// Fills the pixels of 'image' inside the given rectangle.
+void fillRect(sf::Image& image, int left, int top, int width, int height, sf::Color color) {
+    sf::Vector2u size = image.getSize();
+    for (int y = std::max(top, 0); y < std::min(top + height, (int)size.y); ++y) {
+        for (int x = std::max(left, 0); x < std::min(left + width, (int)size.x); ++x) {
+            image.setPixel({(unsigned int)x, (unsigned int)y}, color);
+        }
+    }
+}
+
+// Fills an ellipse centered at (cx, cy) with radii (rx, ry).
+void fillEllipse(sf::Image& image, float cx, float cy, float rx, float ry, sf::Color color) {
+    sf::Vector2u size = image.getSize();
+    for (unsigned int y = 0; y < size.y; ++y) {
+        for (unsigned int x = 0; x < size.x; ++x) {
+            float dx = (x + 0.5f - cx) / rx, dy = (y + 0.5f - cy) / ry;
+            if (dx * dx + dy * dy <= 1.f) image.setPixel({x, y}, color);
+        }
+    }
+}
+
+// Fills a diamond (a gem) of width and height 's' centered at (cx, cy), lighter in the middle.
+void fillDiamond(sf::Image& image, float cx, float cy, float s) {
+    sf::Vector2u size = image.getSize();
+    for (unsigned int y = 0; y < size.y; ++y) {
+        for (unsigned int x = 0; x < size.x; ++x) {
+            float d = std::abs(x + 0.5f - cx) + std::abs(y + 0.5f - cy);
+            if (d <= s / 2.f) image.setPixel({x, y}, d < s / 4.f ? sf::Color(180, 255, 255) : sf::Color(0, 190, 210));
+        }
+    }
+}
+
+} // namespace
+
+// --- Non-Member Function Implementations ---
+
+const char* getSpriteName(SpriteId sprite) {
+    switch (sprite) {
+        case SpriteId::SolidTile: return "solid";
+        case SpriteId::Coin: return "coin";
+        case SpriteId::Player: return "player";
+        case SpriteId::Enemy: return "enemy";
+        case SpriteId::Pickup: return "pickup";
+        case SpriteId::Spikes: return "spikes";
+        case SpriteId::Platform: return "platform";
+        case SpriteId::GemTile: return "gem";
+        default: return "?";
+    }
+}
+
+// Draws the built-in art for 'sprite', in the spirit of the original game's palette.
+sf::Image createDefaultSprite(SpriteId sprite) {
+    const int T = (int)TILE_SIZE;
+    sf::Image image;
+    switch (sprite) {
+        case SpriteId::SolidTile: {
+            // Red bricks with grey mortar, every other row offset by half a brick.
+            image.resize({(unsigned int)T, (unsigned int)T}, sf::Color(150, 150, 150));
+            const int rowHeight = T / 4, brickWidth = T / 2;
+            for (int row = 0; row < 4; ++row) {
+                int offset = (row % 2) * brickWidth / 2;
+                for (int x = -brickWidth + offset; x < T; x += brickWidth) {
+                    fillRect(image, x + 1, row * rowHeight + 1, brickWidth - 2, rowHeight - 2, sf::Color(178, 34, 34));
+                    fillRect(image, x + 1, row * rowHeight + 1, brickWidth - 2, 1, sf::Color(205, 92, 72)); // Highlight
+                }
+            }
+            break;
+        }
+        case SpriteId::Coin: {
+            // Gold coin with a darker rim and a shine, centered in a tile-sized cell.
+            image.resize({(unsigned int)T, (unsigned int)T}, sf::Color::Transparent);
+            const float c = T / 2.f, r = T * 0.3f;
+            fillEllipse(image, c, c, r, r, sf::Color(184, 134, 11));
+            fillEllipse(image, c, c, r - 2.f, r - 2.f, sf::Color(255, 215, 0));
+            fillEllipse(image, c - r * 0.35f, c - r * 0.35f, r * 0.25f, r * 0.2f, sf::Color(255, 250, 205));
+            break;
+        }
+        case SpriteId::Player: {
+            // Same size as the player's bounding box: red cap, face, green shirt, blue jeans.
+            const int w = (int)(TILE_SIZE * 0.8f), h = (int)(TILE_SIZE * 0.95f);
+            image.resize({(unsigned int)w, (unsigned int)h}, sf::Color::Transparent);
+            fillRect(image, w / 4, 0, w / 2, h / 8, sf::Color(200, 30, 30));                  // Cap
+            fillRect(image, w / 4, h / 8, w / 2 + w / 8, h / 40 + 1, sf::Color(200, 30, 30)); // Peak
+            fillRect(image, w / 4, h / 8 + 2, w / 2, h / 5, sf::Color(255, 205, 160));        // Face
+            fillRect(image, w / 2 + 2, h / 8 + 5, 2, 2, sf::Color::Black);                     // Eye
+            fillRect(image, w / 8, h / 3, w * 3 / 4, h / 3, sf::Color(34, 160, 34));           // Shirt
+            fillRect(image, w / 4, h * 2 / 3, w / 5, h / 3, sf::Color(40, 60, 170));           // Legs
+            fillRect(image, w * 11 / 20, h * 2 / 3, w / 5, h / 3, sf::Color(40, 60, 170));
+            break;
+        }
+        case SpriteId::Enemy: {
+            // A purple spider: round body, eight legs, white eyes.
+            const int w = T, h = T * 3 / 4;
+            image.resize({(unsigned int)w, (unsigned int)h}, sf::Color::Transparent);
+            for (int leg = 0; leg < 4; ++leg) {
+                int y = h / 4 + leg * h / 8;
+                fillRect(image, 1, y, w - 2, 2, sf::Color(90, 20, 110));
+            }
+            fillEllipse(image, w / 2.f, h / 2.f, w * 0.3f, h * 0.4f, sf::Color(140, 40, 170));
+            fillRect(image, w / 2 - 5, h / 3, 3, 3, sf::Color::White);
+            fillRect(image, w / 2 + 2, h / 3, 3, 3, sf::Color::White);
+            break;
+        }
+        case SpriteId::Pickup: {
+            // A cyan diamond-shaped gem.
+            const int s = T * 3 / 5;
+            image.resize({(unsigned int)s, (unsigned int)s}, sf::Color::Transparent);
+            fillDiamond(image, s / 2.f, s / 2.f, (float)s);
+            break;
+        }
+        case SpriteId::Spikes: {
+            // A row of grey spikes standing on the bottom of the tile.
+            image.resize({(unsigned int)T, (unsigned int)T}, sf::Color::Transparent);
+            const int spikes = 4, width = T / spikes, height = T / 2;
+            for (int i = 0; i < spikes; ++i) {
+                for (int y = 0; y < height; ++y) {
+                    int half = width * (y + 1) / (2 * height); // Widens towards the base
+                    int center = i * width + width / 2;
+                    fillRect(image, center - half, T - height + y, 2 * half, 1,
+                             y < 2 ? sf::Color(230, 230, 230) : sf::Color(140, 140, 150));
+                }
+            }
+            break;
+        }
+        case SpriteId::Platform: {
+            // A thin wooden plank along the top of the tile (the part that can be stood on).
+            image.resize({(unsigned int)T, (unsigned int)T}, sf::Color::Transparent);
+            fillRect(image, 0, 0, T, T / 4, sf::Color(139, 90, 43));
+            fillRect(image, 0, 0, T, 2, sf::Color(190, 135, 75)); // Highlight
+            fillRect(image, T / 2 - 1, 2, 2, T / 4 - 2, sf::Color(100, 60, 25)); // Board joint
+            break;
+        }
+        case SpriteId::GemTile: {
+            // The pickup gem, centered in a tile-sized cell like the coin.
+            image.resize({(unsigned int)T, (unsigned int)T}, sf::Color::Transparent);
+            fillDiamond(image, T / 2.f, T / 2.f, T * 0.6f);
+            break;
+        }
+        default:
+            image.resize({1, 1}, sf::Color::Magenta);
+            break;
+    }
+    return image;
+}
+
+// --- Member Function Implementations ---
+
+// Loads every sprite that has a file, then builds the atlas from them.
+bool SpriteAtlas::build(const std::string& assetDirectory) {
+    const std::size_t spriteCount = (std::size_t)SpriteId::Count;
+    std::vector<sf::Image> loaded(spriteCount);
+    SpriteImages art{};
+    for (std::size_t i = 0; i < spriteCount; ++i) {
+        std::filesystem::path path = std::filesystem::path(assetDirectory) / (std::string(getSpriteName((SpriteId)i)) + ".png");
+        std::error_code error;
+        if (!assetDirectory.empty() && std::filesystem::exists(path, error)) {
+            if (loaded[i].loadFromFile(path)) {
+                art[i] = &loaded[i];
+                continue;
+            }
+            std::cerr << "Warning: could not load sprite " << path.string() << ", using the built-in one" << std::endl;
+        }
+    }
+    return build(art);
+}
+
+// Draws the sprites without art, packs them all on shelves and uploads the atlas.
+bool SpriteAtlas::build(const SpriteImages& art) {
+    const std::size_t spriteCount = (std::size_t)SpriteId::Count;
+    std::vector<sf::Image> drawn(spriteCount);
+    std::vector<const sf::Image*> images(spriteCount);
+    for (std::size_t i = 0; i < spriteCount; ++i) {
+        if (art[i] && art[i]->getSize().x > 0 && art[i]->getSize().y > 0) {
+            images[i] = art[i];
+        } else {
+            drawn[i] = createDefaultSprite((SpriteId)i);
+            images[i] = &drawn[i];
+        }
+    }
+
+    // Shelf packing: tallest first, left to right, starting a new shelf when a row is full.
+    std::vector<std::size_t> order(spriteCount);
+    for (std::size_t i = 0; i < spriteCount; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return images[a]->getSize().y > images[b]->getSize().y;
+    });
+    std::vector<sf::Vector2u> positions(spriteCount);
+    unsigned int penX = 0, shelfTop = 0, shelfHeight = 0, atlasWidth = ATLAS_WIDTH;
+    for (std::size_t i : order) {
+        sf::Vector2u cell = images[i]->getSize() + sf::Vector2u(2 * SPRITE_BORDER, 2 * SPRITE_BORDER);
+        atlasWidth = std::max(atlasWidth, cell.x);
+        if (penX + cell.x > atlasWidth) {
+            shelfTop += shelfHeight;
+            penX = 0;
+            shelfHeight = 0;
+        }
+        positions[i] = {penX + SPRITE_BORDER, shelfTop + SPRITE_BORDER};
+        penX += cell.x;
+        shelfHeight = std::max(shelfHeight, cell.y);
+    }
+    unsigned int atlasHeight = shelfTop + shelfHeight;
+
+    // Copy the sprites in, then extrude each one's edge pixels into its border.
+    sf::Image atlas({atlasWidth, atlasHeight}, sf::Color::Transparent);
+    for (std::size_t i = 0; i < spriteCount; ++i) {
+        const sf::Image& image = *images[i];
+        sf::Vector2u size = image.getSize(), at = positions[i];
+        for (int y = -(int)SPRITE_BORDER; y < (int)(size.y + SPRITE_BORDER); ++y) {
+            for (int x = -(int)SPRITE_BORDER; x < (int)(size.x + SPRITE_BORDER); ++x) {
+                unsigned int sx = (unsigned int)std::clamp(x, 0, (int)size.x - 1);
+                unsigned int sy = (unsigned int)std::clamp(y, 0, (int)size.y - 1);
+                atlas.setPixel({(unsigned int)((int)at.x + x), (unsigned int)((int)at.y + y)}, image.getPixel({sx, sy}));
+            }
+        }
+        rects[i] = {{(float)at.x, (float)at.y}, {(float)size.x, (float)size.y}};
+    }
+
+    if (!texture.loadFromImage(atlas)) {
+        std::cerr << "Error creating the sprite atlas texture (" << atlasWidth << "x" << atlasHeight << ")" << std::endl;
+        return false;
+    }
+    texture.setSmooth(false); // Pixel art; also keeps texels from blending across sprites
+    return true;
+}
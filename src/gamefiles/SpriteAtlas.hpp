@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <SFML/Graphics/Image.hpp>   // For sf::Image
+#include <SFML/Graphics/Rect.hpp>    // For sf::FloatRect
+#include <SFML/Graphics/Texture.hpp> // For sf::Texture
+#include "RenderTypes.hpp"            // SpriteId
+
+// Short file-friendly names, e.g. "solid" (art is looked up as <name>.png).
+const char* getSpriteName(SpriteId sprite);
+
+// Packs every sprite into one texture at startup.
+// Each sprite comes from <assetDirectory>/<name>.png if that file exists, and is drawn
+// procedurally otherwise, so the game runs without any art on disk. Sprites are packed
+// on shelves with a 1-pixel border copied from their edge pixels, so neighbouring sprites
+// never bleed in when the view is zoomed or scrolled by fractions of a pixel.
+class SpriteAtlas {
+public:
+    // Builds the atlas. Returns false (after printing the problem to std::cerr) if the
+    // texture cannot be created; missing or broken art files only print a warning.
+    bool build(const std::string& assetDirectory);
+    // Builds the atlas from art that is already loaded; null entries (and empty images)
+    // use the built-in art.
+    using SpriteImages = std::array<const sf::Image*, (std::size_t)SpriteId::Count>;
+    bool build(const SpriteImages& art);
+
+    const sf::Texture& getTexture() const { return texture; }
+    // Texture rectangle of 'sprite', in pixels (what sf::Vertex::texCoords expects).
+    const sf::FloatRect& getRect(SpriteId sprite) const { return rects[(std::size_t)sprite]; }
+
+private:
+    sf::Texture texture;
+    std::array<sf::FloatRect, (std::size_t)SpriteId::Count> rects{};
+};
+
+// Draws the built-in art for 'sprite' (used when there is no file for it).
+sf::Image createDefaultSprite(SpriteId sprite);
@@ -0,0 +1,51 @@
+#include "SpriteBatch.hpp" // Include the header definition for SpriteBatch
+#include <SFML/Graphics/PrimitiveType.hpp> // For sf::PrimitiveType
+#include <SFML/Graphics/RenderStates.hpp>  // For binding the atlas texture
+
+// --- Member Function Implementations ---
+
+// Starts a new frame. clear() keeps each buffer's capacity.
+void SpriteBatch::begin() {
+    for (std::vector<sf::Vertex>& layer : layers) {
+        layer.clear();
+    }
+}
+
+// Queues one quad as two triangles.
+void SpriteBatch::addQuad(RenderLayer layer, const sf::FloatRect& destination, const sf::FloatRect& textureRect,
+                          sf::Color tint) {
+    float left = destination.position.x, top = destination.position.y;
+    float right = left + destination.size.x, bottom = top + destination.size.y;
+    float u0 = textureRect.position.x, v0 = textureRect.position.y;
+    float u1 = u0 + textureRect.size.x, v1 = v0 + textureRect.size.y;
+
+    std::vector<sf::Vertex>& vertices = layers[(std::size_t)layer];
+    vertices.push_back({{left, top}, tint, {u0, v0}});
+    vertices.push_back({{right, top}, tint, {u1, v0}});
+    vertices.push_back({{left, bottom}, tint, {u0, v1}});
+    vertices.push_back({{left, bottom}, tint, {u0, v1}});
+    vertices.push_back({{right, top}, tint, {u1, v0}});
+    vertices.push_back({{right, bottom}, tint, {u1, v1}});
+}
+
+// Queues prebuilt triangles.
+void SpriteBatch::addTriangles(RenderLayer layer, const sf::Vertex* vertices, std::size_t count) {
+    std::vector<sf::Vertex>& destination = layers[(std::size_t)layer];
+    destination.insert(destination.end(), vertices, vertices + count);
+}
+
+// Joins the layers back to front and draws them in one call.
+void SpriteBatch::flush(sf::RenderTarget& target, const sf::Texture& texture) {
+    frameVertices.clear();
+    for (const std::vector<sf::Vertex>& layer : layers) {
+        frameVertices.insert(frameVertices.end(), layer.begin(), layer.end());
+    }
+
+    lastVertexCount = frameVertices.size();
+    lastDrawCalls = 0;
+    if (frameVertices.empty()) return;
+    sf::RenderStates states;
+    states.texture = &texture;
+    target.draw(frameVertices.data(), frameVertices.size(), sf::PrimitiveType::Triangles, states);
+    lastDrawCalls = 1;
+}
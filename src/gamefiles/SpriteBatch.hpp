@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Color.hpp>        // For tints
+#include <SFML/Graphics/Rect.hpp>         // For sf::FloatRect
+#include <SFML/Graphics/RenderTarget.hpp> // For sf::RenderTarget
+#include <SFML/Graphics/Texture.hpp>      // For sf::Texture
+#include <SFML/Graphics/Vertex.hpp>       // For sf::Vertex
+#include "RenderTypes.hpp"                 // RenderLayer
+
+// Collects textured quads for one frame and draws them with as few draw calls as possible.
+// Quads are bucketed by layer as they are added (a stable counting sort: within a layer,
+// submission order is kept), then the buckets are joined into one vertex buffer and drawn
+// with one call, since everything shares one atlas texture. The buffers keep their
+// capacity between frames, so steady-state frames don't allocate.
+class SpriteBatch {
+public:
+    // Starts a new frame, dropping everything queued so far.
+    void begin();
+
+    // Queues a quad covering 'destination' (world pixels) textured with 'textureRect'
+    // (atlas pixels), e.g. SpriteAtlas::getRect().
+    void addQuad(RenderLayer layer, const sf::FloatRect& destination, const sf::FloatRect& textureRect,
+                 sf::Color tint = sf::Color::White);
+    // Queues prebuilt triangles (e.g. a cached tile chunk), copied as they are.
+    void addTriangles(RenderLayer layer, const sf::Vertex* vertices, std::size_t count);
+
+    // Draws everything queued since begin() with 'texture', back to front.
+    void flush(sf::RenderTarget& target, const sf::Texture& texture);
+
+    // Statistics of the last flush().
+    unsigned int getDrawCalls() const { return lastDrawCalls; }
+    std::size_t getQuadCount() const { return lastVertexCount / 6; }
+
+private:
+    static constexpr std::size_t LAYER_COUNT = (std::size_t)RenderLayer::Count;
+
+    std::array<std::vector<sf::Vertex>, LAYER_COUNT> layers; // Triangles per layer
+    std::vector<sf::Vertex> frameVertices;                   // All layers, back to front
+    unsigned int lastDrawCalls = 0;
+    std::size_t lastVertexCount = 0;
+};
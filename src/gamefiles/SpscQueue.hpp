@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Bounded, lock-free single-producer/single-consumer ring buffer.
+// push() and pop() never block and never allocate: push() fails when the queue is full and
+// pop() fails when it is empty. Exactly one thread may push and exactly one may pop.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Producer: appends 'value'. Returns false (and drops it) if the queue is full.
+    bool push(const T& value) {
+        std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity) return false;
+        slots[tail & (Capacity - 1)] = value;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: removes the oldest element into 'value'. Returns false if the queue is empty.
+    bool pop(T& value) {
+        std::size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) return false;
+        value = slots[head & (Capacity - 1)];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from a thread other than the producer or consumer.
+    bool empty() const { return headIndex.load(std::memory_order_acquire) == tailIndex.load(std::memory_order_acquire); }
+
+private:
+    // Producer and consumer indices on separate cache lines so they don't false-share.
+    alignas(64) std::atomic<std::size_t> headIndex{0}; // Next slot to pop (consumer-owned)
+    alignas(64) std::atomic<std::size_t> tailIndex{0}; // Next slot to push (producer-owned)
+    alignas(64) std::array<T, Capacity> slots{};
+};
@@ -0,0 +1,105 @@
+#include "ThreadPool.hpp" // Include the header definition for ThreadPool
+#include <algorithm>      // For std::max
+#include <utility>        // For std::move
+
+// --- Member Function Implementations ---
+
+// Constructor
+ThreadPool::ThreadPool(unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+// Destructor
+ThreadPool::~ThreadPool() {
+    waitIdle();
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Queues a task. Tasks are spread round-robin over the worker queues.
+void ThreadPool::submit(Task task) {
+    pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    unsigned int index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    // Take the wake mutex so a worker that just found nothing can't miss this notify.
+    { std::lock_guard<std::mutex> lock(wakeMutex); }
+    wakeWorkers.notify_one();
+}
+
+// Blocks until every submitted task has finished.
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeWaiters.wait(lock, [this] { return pendingTasks.load() == 0; });
+}
+
+// Main loop of worker 'index': own queue first, then steal, then sleep.
+void ThreadPool::workerLoop(unsigned int index) {
+    Task task;
+    while (true) {
+        if (popOwn(index, task) || steal(index, task)) {
+            task();
+            task = nullptr; // Release captured state before going idle
+            if (pendingTasks.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                wakeWaiters.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (stopping) {
+            return;
+        }
+        // Re-check under the lock: submit() locks wakeMutex after pushing, so either we
+        // see the task here or we are already waiting when it notifies.
+        wakeWorkers.wait(lock, [this] {
+            if (stopping) return true;
+            for (const auto& queue : queues) {
+                std::lock_guard<std::mutex> queueLock(queue->mutex);
+                if (!queue->tasks.empty()) return true;
+            }
+            return false;
+        });
+    }
+}
+
+// Pops the most recently queued task from this worker's own queue.
+bool ThreadPool::popOwn(unsigned int index, Task& task) {
+    WorkQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+// Takes the oldest task from another worker's queue, starting with the next neighbour.
+bool ThreadPool::steal(unsigned int thief, Task& task) {
+    const unsigned int count = (unsigned int)queues.size();
+    for (unsigned int offset = 1; offset < count; ++offset) {
+        WorkQueue& victim = *queues[(thief + offset) % count];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool of worker threads with per-worker task queues and work stealing.
+// Each worker pops from the back of its own queue (most recently pushed, cache-warm)
+// and, when that runs dry, steals from the front of the other workers' queues.
+// Tasks are independent: there is no ordering guarantee between them.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    // Starts 'threadCount' workers (0 means one per hardware thread).
+    explicit ThreadPool(unsigned int threadCount = 0);
+    // Waits for queued tasks to finish, then joins the workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queues a task. Tasks are spread round-robin over the worker queues.
+    void submit(Task task);
+    // Blocks until every submitted task has finished.
+    void waitIdle();
+
+    unsigned int getThreadCount() const { return (unsigned int)workers.size(); }
+
+private:
+    // One worker's queue, guarded by its own mutex so workers rarely contend.
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(unsigned int index);
+    bool popOwn(unsigned int index, Task& task);
+    bool steal(unsigned int thief, Task& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; // One per worker
+    std::vector<std::thread> workers;
+    std::atomic<unsigned int> nextQueue{0};         // Round-robin submit cursor
+    std::atomic<std::size_t> pendingTasks{0};       // Submitted but not yet finished
+
+    std::mutex wakeMutex;                  // Guards the two condition variables below
+    std::condition_variable wakeWorkers;   // Signalled when work arrives or on shutdown
+    std::condition_variable wakeWaiters;   // Signalled when pendingTasks reaches zero
+    bool stopping = false;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp> // For sf::Vector2f
+
+struct Level;
+
+// --- Tile Collision Resolvers ---
+// Both resolvers take an axis-aligned box centered at 'position' that is about to move by
+// 'velocity' this tick. On contact with a TILE_SOLID tile they snap 'position' against the tile,
+// zero that velocity component and (when landing) set 'isOnGround'. The vertical axis is
+// resolved first, then the horizontal axis using the corrected position. Neither moves the
+// box by the remaining velocity; that is left to the caller.
+
+// Swept resolver: finds the first solid tile row (then column) the leading edge crosses this
+// tick, so fast bodies can't tunnel through thin platforms. Bodies moving at least 5 tiles a
+// tick on either axis (INDEXED_SWEEP_MIN_SPEED) on a level with a SolidityIndex scan each
+// covered column (row) with its bit scans, 64 tiles at a time; all others, and every body on
+// a streamed level, test the crossed rows (columns) tile by tile. The horizontal pass covers the rows of the whole vertical motion, which also stops diagonal
+// movers from clipping tile corners. Bodies that don't move vertically (walking, landed)
+// check exactly the tiles resolveTileCollisionProbe does. TILE_ONE_WAY tiles (platforms)
+// also stop a body whose bottom edge enters their row from above while falling.
+void resolveTileCollisionSwept(const Level& level, sf::Vector2f& position, sf::Vector2f halfSize,
+                               sf::Vector2f& velocity, bool& isOnGround);
+
+// Original resolver: only probes the row/column at 'position + velocity'. Bodies moving more
+// than TILE_SIZE per tick can skip over tiles, and one-way platforms are ignored. Kept as
+// the baseline for collision_bench.
+void resolveTileCollisionProbe(const Level& level, sf::Vector2f& position, sf::Vector2f halfSize,
+                               sf::Vector2f& velocity, bool& isOnGround);
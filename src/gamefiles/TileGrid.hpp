@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class MappedFile; // Only held through a shared_ptr here
+
+// Defines symbolic names for different types of tiles in the level grid.
+// Stored as a single byte so a whole level fits in width * height bytes. What each type
+// does (solid, pickup, ...) is looked up in the table in TileProperties.hpp, so code never
+// compares against specific types.
+enum class TileType : std::uint8_t { // Use 'enum class' for stronger type safety
+    Air = 0,
+    Solid = 1,
+    Coin = 2,
+    Spikes = 3,   // Respawns the player on contact
+    Platform = 4, // Can be jumped through from below and stood on
+    Gem = 5,      // A pickup worth more than a coin
+    Count         // Number of defined types; ids up to 255 are reserved for new ones
+};
+
+// Flat, row-major 2D grid of tiles backed by one contiguous block of memory.
+// Tile (x, y) lives at data[y * width + x], so a lookup is a single multiply-add.
+// The block is either owned ('cells') or borrowed from a memory-mapped level file
+// ('mapping'); copying a grid always produces an owned copy.
+struct TileGrid {
+    // --- Member Variables ---
+    std::vector<TileType> cells;         // Owned storage (empty when the grid is mapped)
+    std::shared_ptr<MappedFile> mapping; // Keeps mapped storage alive (null when owned)
+    TileType* data = nullptr;            // width * height tiles, row-major
+    unsigned int width = 0;              // Number of columns
+    unsigned int height = 0;             // Number of rows
+
+    // --- Construction ---
+    TileGrid() = default;
+    TileGrid(const TileGrid& other) { *this = other; }
+    TileGrid(TileGrid&&) = default; // Moving a vector keeps its buffer, so 'data' stays valid
+    TileGrid& operator=(TileGrid&&) = default;
+    TileGrid& operator=(const TileGrid& other) {
+        if (this != &other) {
+            cells.assign(other.data, other.data + other.getCellCount());
+            mapping.reset();
+            data = cells.data();
+            width = other.width;
+            height = other.height;
+        }
+        return *this;
+    }
+
+    // --- Member Functions ---
+    // Reallocates the grid to newWidth x newHeight, filling every cell with 'fill'.
+    void resize(unsigned int newWidth, unsigned int newHeight, TileType fill = TileType::Air) {
+        width = newWidth;
+        height = newHeight;
+        mapping.reset();
+        cells.assign(getCellCount(), fill);
+        data = cells.data();
+    }
+
+    // Uses 'tiles' (width * height bytes inside 'file') as storage without copying.
+    void adopt(std::shared_ptr<MappedFile> file, TileType* tiles, unsigned int newWidth, unsigned int newHeight) {
+        cells.clear();
+        cells.shrink_to_fit();
+        mapping = std::move(file);
+        data = tiles;
+        width = newWidth;
+        height = newHeight;
+    }
+
+    std::size_t getCellCount() const { return static_cast<std::size_t>(width) * height; }
+
+    // Is (x, y) inside the grid? The unsigned casts fold the '>= 0' checks into one compare per axis.
+    bool inBounds(int x, int y) const {
+        return static_cast<unsigned int>(x) < width && static_cast<unsigned int>(y) < height;
+    }
+
+    // Unchecked access, only for coordinates already known to be inside the grid.
+    TileType at(int x, int y) const { return data[static_cast<std::size_t>(y) * width + x]; }
+    TileType& at(int x, int y) { return data[static_cast<std::size_t>(y) * width + x]; }
+
+    // Bounds-checked read, out of bounds is treated as Air.
+    TileType get(int x, int y) const { return inBounds(x, y) ? at(x, y) : TileType::Air; }
+
+    // Bounds-checked write, returns false (and changes nothing) when out of bounds.
+    bool set(int x, int y, TileType newType) {
+        if (!inBounds(x, y)) return false;
+        at(x, y) = newType;
+        return true;
+    }
+};
@@ -0,0 +1,123 @@
+#include "TileMapRenderer.hpp" // Include the header definition for TileMapRenderer
+#include "Level.hpp"           // Include the full definition of Level
+#include "Constants.hpp"       // Include global constants like TILE_SIZE
+#include <algorithm>           // For std::max, std::min
+#include <cmath>               // For std::floor
+
+// --- Geometry Helpers ---
+
+namespace {
+
+const std::size_t MAX_CACHED_CHUNKS = 64; // Geometry kept for off-screen chunks before trimming
+
+// Appends a textured rectangle as two triangles.
+void appendQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f topLeft, sf::Vector2f size, const sf::FloatRect& texture) {
+    sf::Vector2f topRight = {topLeft.x + size.x, topLeft.y};
+    sf::Vector2f bottomLeft = {topLeft.x, topLeft.y + size.y};
+    sf::Vector2f bottomRight = topLeft + size;
+    sf::Vector2f uvTopLeft = texture.position;
+    sf::Vector2f uvTopRight = {texture.position.x + texture.size.x, texture.position.y};
+    sf::Vector2f uvBottomLeft = {texture.position.x, texture.position.y + texture.size.y};
+    sf::Vector2f uvBottomRight = texture.position + texture.size;
+    vertices.push_back({topLeft, sf::Color::White, uvTopLeft});
+    vertices.push_back({topRight, sf::Color::White, uvTopRight});
+    vertices.push_back({bottomLeft, sf::Color::White, uvBottomLeft});
+    vertices.push_back({bottomLeft, sf::Color::White, uvBottomLeft});
+    vertices.push_back({topRight, sf::Color::White, uvTopRight});
+    vertices.push_back({bottomRight, sf::Color::White, uvBottomRight});
+}
+
+} // namespace
+
+// --- Member Function Implementations ---
+
+// Submits every chunk visible in 'view' to the batch, rebuilding stale chunks first.
+void TileMapRenderer::draw(SpriteBatch& batch, const sf::View& view, const Level& level) {
+    // A different level, or a new one loaded into the same Level object, invalidates the
+    // whole cache.
+    if (boundGeneration != level.generation.value) {
+        invalidate();
+        boundGeneration = level.generation.value;
+        chunks.resize(level.chunkRevisions.size());
+    }
+
+    // View Culling (in chunks rather than tiles)
+    sf::Vector2f viewTopLeft = view.getCenter() - view.getSize() / 2.f;
+    sf::Vector2f viewBottomRight = viewTopLeft + view.getSize();
+    const float chunkPixels = (float)LEVEL_CHUNK_SIZE * TILE_SIZE;
+    int startX = std::max(0, static_cast<int>(std::floor(viewTopLeft.x / chunkPixels)));
+    int endX = std::min((int)level.chunkCount.x, static_cast<int>(viewBottomRight.x / chunkPixels) + 1);
+    int startY = std::max(0, static_cast<int>(std::floor(viewTopLeft.y / chunkPixels)));
+    int endY = std::min((int)level.chunkCount.y, static_cast<int>(viewBottomRight.y / chunkPixels) + 1);
+
+    lastChunksDrawn = 0;
+    lastTilesDrawn = 0;
+    for (int cy = startY; cy < endY; ++cy) {
+        for (int cx = startX; cx < endX; ++cx) {
+            Chunk& chunk = chunks[cy * level.chunkCount.x + cx];
+            unsigned int revision = level.getChunkRevision(cx, cy);
+            if (!chunk.built || chunk.builtRevision != revision) {
+                if (!chunk.built) builtChunks.push_back(cy * level.chunkCount.x + cx);
+                rebuildChunk(chunk, level, cx, cy);
+                chunk.builtRevision = revision;
+                chunk.built = true;
+            }
+            if (chunk.tileCount > 0) {
+                for (std::size_t layer = 0; layer < chunk.layers.size(); ++layer) {
+                    const std::vector<sf::Vertex>& vertices = chunk.layers[layer];
+                    if (!vertices.empty()) batch.addTriangles((RenderLayer)layer, vertices.data(), vertices.size());
+                }
+                lastChunksDrawn++;
+                lastTilesDrawn += chunk.tileCount;
+            }
+        }
+    }
+
+    // On long (streamed) levels, free the geometry of chunks that scrolled far away.
+    if (builtChunks.size() > MAX_CACHED_CHUNKS) {
+        auto isVisible = [&](std::size_t index) {
+            int cx = (int)(index % level.chunkCount.x), cy = (int)(index / level.chunkCount.x);
+            return cx >= startX && cx < endX && cy >= startY && cy < endY;
+        };
+        std::size_t kept = 0;
+        for (std::size_t index : builtChunks) {
+            if (isVisible(index)) {
+                builtChunks[kept++] = index;
+            } else {
+                chunks[index] = Chunk();
+            }
+        }
+        builtChunks.resize(kept);
+    }
+}
+
+// Drops all cached geometry (e.g. after loading a different level).
+void TileMapRenderer::invalidate() {
+    chunks.clear();
+    builtChunks.clear();
+    boundGeneration = 0;
+}
+
+// Rebuilds the geometry of chunk (cx, cy) from the level's tiles.
+void TileMapRenderer::rebuildChunk(Chunk& chunk, const Level& level, int cx, int cy) {
+    for (std::vector<sf::Vertex>& vertices : chunk.layers) {
+        vertices.clear();
+    }
+    chunk.tileCount = 0;
+    int startX = cx * LEVEL_CHUNK_SIZE;
+    int startY = cy * LEVEL_CHUNK_SIZE;
+    int endX = std::min((int)level.size.x, startX + LEVEL_CHUNK_SIZE);
+    int endY = std::min((int)level.size.y, startY + LEVEL_CHUNK_SIZE);
+
+    for (int y = startY; y < endY; ++y) {
+        for (int x = startX; x < endX; ++x) {
+            // Every tile is one quad; its sprite and layer come from the property table.
+            const TileProperties& tile = getTileProperties(level.getTile(x, y));
+            if (tile.flags & TILE_VISIBLE) {
+                appendQuad(chunk.layers[(std::size_t)tile.layer], {(float)x * TILE_SIZE, (float)y * TILE_SIZE},
+                           {(float)TILE_SIZE, (float)TILE_SIZE}, atlas.getRect(tile.sprite));
+                chunk.tileCount++;
+            }
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Vertex.hpp> // For sf::Vertex
+#include <SFML/Graphics/View.hpp>   // For view culling
+#include "SpriteAtlas.hpp"          // Texture rectangles of the tile sprites
+#include "SpriteBatch.hpp"          // Where the visible geometry is submitted
+
+// Forward declaration, the full definition is only needed in TileMapRenderer.cpp.
+struct Level;
+
+// Draws a Level using cached vertex geometry.
+// The level is split into chunks of LEVEL_CHUNK_SIZE x LEVEL_CHUNK_SIZE tiles.
+// Each chunk is turned into textured quads (one per TILE_VISIBLE tile, with the sprite and
+// layer from its TileProperties) the first time it becomes visible and is only rebuilt when Level::setTile
+// changes one of its tiles. Visible chunks are handed to a SpriteBatch, so the tiles
+// share a draw call with everything else in the frame.
+struct TileMapRenderer {
+    // --- Member Variables ---
+    // Cached geometry for one chunk of the level.
+    struct Chunk {
+        // Quads of the visible tiles, 6 vertices each, bucketed by the tile's render layer.
+        std::array<std::vector<sf::Vertex>, (std::size_t)RenderLayer::Count> layers;
+        unsigned int builtRevision = 0;                          // Level revision the geometry was built from
+        unsigned int tileCount = 0;                              // Non-empty tiles in the geometry
+        bool built = false;                                      // Has the geometry been built at all?
+    };
+
+    const SpriteAtlas& atlas;        // Texture rectangles for the tiles
+    std::vector<Chunk> chunks;       // One entry per level chunk, row-major
+    std::vector<std::size_t> builtChunks; // Indices of chunks that currently hold geometry
+    std::uint64_t boundGeneration = 0; // Level::generation the cache was built for (0: none)
+    unsigned int lastChunksDrawn = 0; // Chunks submitted by the last draw()
+    unsigned int lastTilesDrawn = 0; // Non-empty tiles in the chunks drawn by the last draw()
+
+    // --- Member Functions (Declarations) ---
+    explicit TileMapRenderer(const SpriteAtlas& atlas) : atlas(atlas) {}
+
+    // Submits every chunk visible in 'view' to 'batch', rebuilding
+    // stale chunks first.
+    void draw(SpriteBatch& batch, const sf::View& view, const Level& level);
+    // Drops all cached geometry (e.g. after loading a different level).
+    void invalidate();
+
+private:
+    // Rebuilds the geometry of chunk (cx, cy) from the level's tiles.
+    void rebuildChunk(Chunk& chunk, const Level& level, int cx, int cy);
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "TileGrid.hpp"    // TileType
+#include "RenderTypes.hpp" // SpriteId, RenderLayer
+
+// --- Tile Behaviour Flags ---
+// Bits of TileProperties::flags. Hot loops test these with one AND instead of comparing
+// against a list of tile types, so adding a type never adds a branch.
+enum TileFlags : std::uint8_t {
+    TILE_SOLID = 1 << 0,   // Blocks movement from every side
+    TILE_ONE_WAY = 1 << 1, // Only blocks bodies falling onto it from above
+    TILE_PICKUP = 1 << 2,  // Collected (and removed) when the player overlaps it
+    TILE_HAZARD = 1 << 3,  // Respawns the player on contact
+    TILE_VISIBLE = 1 << 4  // Has a sprite; drawn by the TileMapRenderer
+};
+
+// Everything the game needs to know about one tile type.
+struct TileProperties {
+    std::uint8_t flags = 0;                   // TileFlags
+    RenderLayer layer = RenderLayer::Tiles;   // Batch layer the tile is drawn in
+    SpriteId sprite = SpriteId::SolidTile;    // Atlas entry (only if TILE_VISIBLE)
+    std::uint8_t score = 0;                   // Points for collecting it (only if TILE_PICKUP)
+    char symbol = '.';                        // Character in ASCII level maps
+};
+
+// Builds the table at compile time. Every possible byte has an entry, so a lookup never
+// needs a bounds check; undefined ids behave like Air.
+constexpr std::array<TileProperties, 256> makeTilePropertyTable() {
+    std::array<TileProperties, 256> table{};
+    table[(std::size_t)TileType::Air] = {0, RenderLayer::Tiles, SpriteId::SolidTile, 0, '.'};
+    table[(std::size_t)TileType::Solid] = {TILE_SOLID | TILE_VISIBLE, RenderLayer::Tiles, SpriteId::SolidTile, 0, '#'};
+    table[(std::size_t)TileType::Coin] = {TILE_PICKUP | TILE_VISIBLE, RenderLayer::Pickups, SpriteId::Coin, 1, 'o'};
+    table[(std::size_t)TileType::Spikes] = {TILE_HAZARD | TILE_VISIBLE, RenderLayer::Tiles, SpriteId::Spikes, 0, '^'};
+    table[(std::size_t)TileType::Platform] = {TILE_ONE_WAY | TILE_VISIBLE, RenderLayer::Tiles, SpriteId::Platform, 0, '='};
+    table[(std::size_t)TileType::Gem] = {TILE_PICKUP | TILE_VISIBLE, RenderLayer::Pickups, SpriteId::GemTile, 5, '*'};
+    return table;
+}
+
+inline constexpr std::array<TileProperties, 256> TILE_PROPERTIES = makeTilePropertyTable();
+
+// --- Lookups ---
+constexpr const TileProperties& getTileProperties(TileType type) { return TILE_PROPERTIES[(std::uint8_t)type]; }
+constexpr std::uint8_t getTileFlags(TileType type) { return TILE_PROPERTIES[(std::uint8_t)type].flags; }
+
+// Does 'type' have any of the flags in 'mask'?
+constexpr bool hasTileFlag(TileType type, std::uint8_t mask) { return (getTileFlags(type) & mask) != 0; }
+
+// The tile type written as 'symbol' in ASCII maps. Returns false for unknown symbols.
+constexpr bool findTileBySymbol(char symbol, TileType& type) {
+    for (std::size_t id = 0; id < (std::size_t)TileType::Count; ++id) {
+        if (TILE_PROPERTIES[id].symbol == symbol) {
+            type = (TileType)id;
+            return true;
+        }
+    }
+    return false;
+}
+
+static_assert(getTileFlags(TileType::Air) == 0, "Air must not do anything");
+static_assert(hasTileFlag(TileType::Solid, TILE_SOLID), "Solid tiles must block");
+static_assert(!hasTileFlag(TileType::Platform, TILE_SOLID), "Platforms only block from above");
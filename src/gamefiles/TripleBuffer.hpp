@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Lock-free triple buffer for handing the newest value from one producer thread to one
+// consumer thread. The producer fills its private write buffer and publishes it; the
+// consumer takes the most recently published buffer. Neither side ever waits for the
+// other, and values the consumer was too slow to take are simply replaced.
+// The three T objects are reused, so a T holding vectors stops allocating once their
+// capacity has grown to fit.
+template <typename T>
+class TripleBuffer {
+public:
+    // --- Producer ---
+    // The buffer being filled. Keeps whatever contents it had when it was last recycled.
+    T& getWriteBuffer() { return slots[writeIndex]; }
+    // Makes the write buffer the newest value and takes over the previous newest.
+    void publish() {
+        writeIndex = shared.exchange((std::uint8_t)(writeIndex | FRESH), std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // --- Consumer ---
+    // Switches the read buffer to the newest published value. Returns false (and keeps
+    // the current read buffer) if nothing was published since the last call.
+    bool acquire() {
+        if ((shared.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+        readIndex = shared.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    // The buffer taken by the last acquire().
+    const T& getReadBuffer() const { return slots[readIndex]; }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 3; // Low bits of 'shared': the middle slot
+    static constexpr std::uint8_t FRESH = 4;      // Set when the middle slot is unread
+
+    std::array<T, 3> slots{};
+    alignas(64) std::uint8_t writeIndex = 0;           // Producer only
+    alignas(64) std::uint8_t readIndex = 1;            // Consumer only
+    alignas(64) std::atomic<std::uint8_t> shared{2};   // Middle slot index | FRESH
+};
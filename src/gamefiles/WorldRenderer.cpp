@@ -0,0 +1,32 @@
+#include "WorldRenderer.hpp" // Include the declarations
+
+// --- Non-Member Helper Function Implementations ---
+
+// Queues every entity except 'skipEntity' on its layer.
+void drawEntities(SpriteBatch& batch, const SpriteAtlas& atlas, const EntityStore& entities, std::size_t skipEntity) {
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        if (i == skipEntity) continue;
+        SpriteId sprite;
+        RenderLayer layer;
+        switch (entities.kinds[i]) {
+            case EntityKind::Enemy:
+                sprite = SpriteId::Enemy;
+                layer = RenderLayer::Actors;
+                break;
+            case EntityKind::Pickup:
+                sprite = SpriteId::Pickup;
+                layer = RenderLayer::Pickups;
+                break;
+            default:
+                continue; // Nothing to show (e.g. projectiles have no art yet)
+        }
+        sf::FloatRect bounds = {{entities.posX[i] - entities.halfW[i], entities.posY[i] - entities.halfH[i]},
+                                {2.f * entities.halfW[i], 2.f * entities.halfH[i]}};
+        batch.addQuad(layer, bounds, atlas.getRect(sprite));
+    }
+}
+
+// Queues the player sprite centered on 'center'.
+void drawPlayer(SpriteBatch& batch, const SpriteAtlas& atlas, sf::Vector2f center, sf::Vector2f size) {
+    batch.addQuad(RenderLayer::Player, {center - size / 2.f, size}, atlas.getRect(SpriteId::Player));
+}
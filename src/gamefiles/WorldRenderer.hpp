@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <SFML/System/Vector2.hpp> // For sf::Vector2f
+#include "EntityStore.hpp"         // The entities being drawn
+#include "SpriteAtlas.hpp"         // Their sprites
+#include "SpriteBatch.hpp"         // Where they are queued
+
+// --- Non-Member Helper Functions (Declarations) ---
+// Shared by the game and render_bench, so both draw the world exactly the same way.
+
+// Queues every entity except 'skipEntity' (the player, drawn at its interpolated position
+// by drawPlayer) on its layer. Kinds without a sprite are skipped.
+void drawEntities(SpriteBatch& batch, const SpriteAtlas& atlas, const EntityStore& entities, std::size_t skipEntity);
+
+// Queues the player sprite centered on 'center' with the given size (pixels).
+void drawPlayer(SpriteBatch& batch, const SpriteAtlas& atlas, sf::Vector2f center, sf::Vector2f size);
@@ -0,0 +1,189 @@
+#include "WorldSnapshot.hpp" // Include the header definition for the snapshot types
+#include "Simulation.hpp"    // The state being saved and restored
+#include <algorithm>         // For std::min, std::copy
+#include <iostream>          // For std::cerr
+
+// --- SnapshotStore ---
+
+// Replaces the chunks whose revision changed since they were copied.
+void SnapshotStore::refresh(const Level& level) {
+    std::size_t chunkTotal = (std::size_t)level.chunkCount.x * level.chunkCount.y;
+    if (level.size != levelSize || chunks.size() != chunkTotal) {
+        chunks.assign(chunkTotal, nullptr);
+        revisions.assign(chunkTotal, 0);
+        levelSize = level.size;
+    }
+    for (std::size_t index = 0; index < chunkTotal; ++index) {
+        if (chunks[index] && revisions[index] == level.chunkRevisions[index]) continue;
+
+        // Copy the chunk row by row out of the flat grid.
+        auto chunk = std::make_shared<TileChunk>();
+        int x0 = (int)(index % level.chunkCount.x) * LEVEL_CHUNK_SIZE;
+        int y0 = (int)(index / level.chunkCount.x) * LEVEL_CHUNK_SIZE;
+        int width = std::min(LEVEL_CHUNK_SIZE, (int)level.size.x - x0);
+        int height = std::min(LEVEL_CHUNK_SIZE, (int)level.size.y - y0);
+        for (int y = 0; y < height; ++y) {
+            const TileType* row = level.tiles.data + (std::size_t)(y0 + y) * level.tiles.width + x0;
+            std::copy(row, row + width, chunk->tiles.begin() + (std::size_t)y * LEVEL_CHUNK_SIZE);
+        }
+        chunks[index] = std::move(chunk);
+        revisions[index] = level.chunkRevisions[index];
+        chunkCopies++;
+    }
+}
+
+// Fills 'snapshot' with the current state of 'sim'.
+bool SnapshotStore::capture(const Simulation& sim, WorldSnapshot& snapshot) {
+    if (sim.level.stream) {
+        std::cerr << "Snapshots need a fully loaded level, not a streamed one" << std::endl;
+        return false;
+    }
+    refresh(sim.level);
+    snapshot.tick = sim.tick;
+    snapshot.levelSize = sim.level.size;
+    snapshot.chunks = chunks; // Shares every chunk; nothing is copied here
+    snapshot.entities = sim.entities;
+    snapshot.score = sim.player.score;
+    return true;
+}
+
+// Puts 'sim' back into the state of 'snapshot'.
+bool SnapshotStore::restore(const WorldSnapshot& snapshot, Simulation& sim) {
+    Level& level = sim.level;
+    if (!snapshot.isValid() || level.stream || snapshot.levelSize != level.size) {
+        std::cerr << "Snapshot does not belong to the current level" << std::endl;
+        return false;
+    }
+    refresh(level);
+
+    for (std::size_t index = 0; index < chunks.size(); ++index) {
+        if (chunks[index] == snapshot.chunks[index]) continue; // Same copy, same tiles
+        const TileChunk& saved = *snapshot.chunks[index];
+        int x0 = (int)(index % level.chunkCount.x) * LEVEL_CHUNK_SIZE;
+        int y0 = (int)(index / level.chunkCount.x) * LEVEL_CHUNK_SIZE;
+        int width = std::min(LEVEL_CHUNK_SIZE, (int)level.size.x - x0);
+        int height = std::min(LEVEL_CHUNK_SIZE, (int)level.size.y - y0);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                TileType type = saved.tiles[(std::size_t)y * LEVEL_CHUNK_SIZE + x];
+                if (level.tiles.at(x0 + x, y0 + y) != type) {
+                    level.setTile(x0 + x, y0 + y, type);
+                }
+            }
+        }
+        // The live chunk now matches the saved copy; share it instead of copying it again.
+        chunks[index] = snapshot.chunks[index];
+        revisions[index] = level.chunkRevisions[index];
+    }
+
+    sim.entities = snapshot.entities;
+    sim.player.score = snapshot.score;
+    sim.tick = snapshot.tick;
+    sim.navigator.invalidate(sim.pathWorker);
+    return true;
+}
+
+// --- RewindBuffer ---
+
+// Constructor
+RewindBuffer::RewindBuffer(std::size_t capacity)
+    : ring(std::max<std::size_t>(capacity, 1))
+{
+}
+
+// Forgets every recorded tick.
+void RewindBuffer::reset(const Simulation& sim) {
+    newest = 0;
+    count = 0;
+    heldBytes = 0;
+    last = sim.entities;
+    lastTick = sim.tick;
+    lastScore = sim.player.score;
+}
+
+// Records the tick sim.step() just ran.
+void RewindBuffer::record(const Simulation& sim, const std::vector<TileChange>& tileChanges) {
+    if (count > 0) {
+        newest = (newest + 1) % ring.size();
+    }
+    TickUndo& undo = ring[newest];
+    if (count == ring.size()) {
+        heldBytes -= getBytes(undo); // Overwrites the oldest tick
+    } else {
+        count++;
+    }
+
+    undo.tick = lastTick;
+    undo.score = lastScore;
+    undo.entityCount = last.size();
+    undo.entities.clear();
+    // Only entities the tick changed (or removed) are kept; resting ones cost nothing.
+    const EntityStore& now = sim.entities;
+    for (std::size_t i = 0; i < last.size(); ++i) {
+        bool changed = i >= now.size() || last.posX[i] != now.posX[i] || last.posY[i] != now.posY[i] ||
+                       last.velX[i] != now.velX[i] || last.velY[i] != now.velY[i] ||
+                       last.halfW[i] != now.halfW[i] || last.halfH[i] != now.halfH[i] ||
+                       last.gravityScale[i] != now.gravityScale[i] || last.flags[i] != now.flags[i] ||
+                       last.kinds[i] != now.kinds[i];
+        if (!changed) continue;
+        EntityRecord record;
+        record.index = (std::uint32_t)i;
+        record.posX = last.posX[i];
+        record.posY = last.posY[i];
+        record.velX = last.velX[i];
+        record.velY = last.velY[i];
+        record.halfW = last.halfW[i];
+        record.halfH = last.halfH[i];
+        record.gravityScale = last.gravityScale[i];
+        record.flags = last.flags[i];
+        record.kind = last.kinds[i];
+        undo.entities.push_back(record);
+    }
+    undo.tiles.assign(tileChanges.begin(), tileChanges.end());
+    heldBytes += getBytes(undo);
+
+    last = now; // Reuses last's capacity
+    lastTick = sim.tick;
+    lastScore = sim.player.score;
+}
+
+// Undoes the newest recorded tick.
+bool RewindBuffer::stepBack(Simulation& sim) {
+    if (count == 0) return false;
+    const TickUndo& undo = ring[newest];
+
+    // Tiles newest first, so a tile set twice in one tick ends up as it started.
+    for (auto change = undo.tiles.rbegin(); change != undo.tiles.rend(); ++change) {
+        sim.level.setTile(change->x, change->y, change->previous);
+    }
+    EntityStore& entities = sim.entities;
+    entities.resize(undo.entityCount);
+    for (const EntityRecord& record : undo.entities) {
+        std::size_t i = record.index;
+        entities.posX[i] = record.posX;
+        entities.posY[i] = record.posY;
+        entities.velX[i] = record.velX;
+        entities.velY[i] = record.velY;
+        entities.halfW[i] = record.halfW;
+        entities.halfH[i] = record.halfH;
+        entities.gravityScale[i] = record.gravityScale;
+        entities.flags[i] = record.flags;
+        entities.kinds[i] = record.kind;
+    }
+    sim.tick = undo.tick;
+    sim.player.score = undo.score;
+    sim.navigator.invalidate(sim.pathWorker);
+
+    heldBytes -= getBytes(undo);
+    count--;
+    newest = (newest + ring.size() - 1) % ring.size();
+    last = entities;
+    lastTick = sim.tick;
+    lastScore = sim.player.score;
+    return true;
+}
+
+// Bytes of undo data in one slot.
+std::size_t RewindBuffer::getBytes(const TickUndo& undo) {
+    return sizeof(TickUndo) + undo.entities.size() * sizeof(EntityRecord) + undo.tiles.size() * sizeof(TileChange);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <SFML/System/Vector2.hpp> // For the level size
+#include "Constants.hpp"           // LEVEL_CHUNK_SIZE
+#include "EntityStore.hpp"         // Saved with every snapshot
+#include "Level.hpp"               // TileType, TileChange
+
+struct Simulation;
+
+// --- Tile Chunks ---
+// The tiles of one chunk, copied out of a level. Never modified once made, so any number of
+// snapshots can share one: a snapshot only gets a new chunk where setTile changed it.
+struct TileChunk {
+    std::array<TileType, LEVEL_CHUNK_SIZE * LEVEL_CHUNK_SIZE> tiles{}; // Row-major; Air past the level edge
+};
+using TileChunkRef = std::shared_ptr<const TileChunk>;
+
+// --- Save States ---
+// The whole simulation at one tick (quicksave). Tiles are held as shared chunks, so a
+// snapshot costs one pointer per chunk plus a copy of each chunk changed since the last one.
+struct WorldSnapshot {
+    // --- Member Variables ---
+    std::uint64_t tick = 0;            // Simulation::tick
+    sf::Vector2u levelSize;            // Of the level it was taken from
+    std::vector<TileChunkRef> chunks;  // One per level chunk, row-major; empty = no snapshot
+    EntityStore entities;              // Every body
+    int score = 0;                     // Player::score
+
+    // --- Member Functions ---
+    bool isValid() const { return !chunks.empty(); }
+};
+
+// Takes and restores WorldSnapshots of one Simulation's level, sharing every chunk that
+// did not change between them. Streamed levels are not supported.
+class SnapshotStore {
+public:
+    // Fills 'snapshot' with the current state of 'sim'. Prints the problem to std::cerr and
+    // returns false for streamed levels.
+    bool capture(const Simulation& sim, WorldSnapshot& snapshot);
+    // Puts 'sim' back into the state of 'snapshot'. Tiles that differ are written with
+    // setTile, so the level's indexes and change records stay right. Returns false (and
+    // changes nothing) if the snapshot is of another level.
+    bool restore(const WorldSnapshot& snapshot, Simulation& sim);
+
+    // Chunks copied out of the level so far (for benchmarks).
+    std::size_t getChunkCopies() const { return chunkCopies; }
+
+private:
+    // Replaces the chunks whose revision changed since they were copied.
+    void refresh(const Level& level);
+
+    std::vector<TileChunkRef> chunks;     // Newest copy of every chunk
+    std::vector<unsigned int> revisions;  // Level::chunkRevisions when each was copied
+    sf::Vector2u levelSize;               // Level the copies are of
+    std::size_t chunkCopies = 0;
+};
+
+// --- Rewind ---
+// Undo log of the last 'capacity' ticks: for every tick, the state of what the tick
+// changed (entities that moved, tiles set, the score) from before it. Undoing ticks one by
+// one from the newest walks the simulation back in time. Memory grows with how much
+// changes per tick, not with the size of the level or the number of resting entities.
+class RewindBuffer {
+public:
+    explicit RewindBuffer(std::size_t capacity);
+
+    // Forgets every recorded tick and starts recording from the current state of 'sim'.
+    void reset(const Simulation& sim);
+    // Records the tick sim.step() just ran; 'tileChanges' are the setTile calls it made.
+    // Once full, the oldest tick is dropped.
+    void record(const Simulation& sim, const std::vector<TileChange>& tileChanges);
+    // Undoes the newest recorded tick. Returns false if there is none left.
+    bool stepBack(Simulation& sim);
+
+    std::size_t getTickCount() const { return count; }
+    // Bytes of undo data currently held.
+    std::size_t getMemoryBytes() const { return heldBytes; }
+
+private:
+    // One entity as it was before a tick.
+    struct EntityRecord {
+        std::uint32_t index = 0;
+        float posX = 0.f, posY = 0.f, velX = 0.f, velY = 0.f;
+        float halfW = 0.f, halfH = 0.f, gravityScale = 0.f;
+        std::uint8_t flags = 0;
+        EntityKind kind = EntityKind::Player;
+    };
+    // Everything needed to undo one tick. Slots are reused, so their vectors stop
+    // allocating once the ring has wrapped.
+    struct TickUndo {
+        std::uint64_t tick = 0;              // Simulation::tick before the tick
+        int score = 0;                       // Player::score before the tick
+        std::size_t entityCount = 0;         // EntityStore::size() before the tick
+        std::vector<EntityRecord> entities;  // Entities the tick changed or removed
+        std::vector<TileChange> tiles;       // setTile calls of the tick, oldest first
+    };
+
+    static std::size_t getBytes(const TickUndo& undo);
+
+    std::vector<TickUndo> ring;
+    std::size_t newest = 0;      // Slot of the newest tick
+    std::size_t count = 0;       // Ticks held
+    std::size_t heldBytes = 0;
+    EntityStore last;            // State after the newest recorded tick, to diff against
+    std::uint64_t lastTick = 0;
+    int lastScore = 0;
+};
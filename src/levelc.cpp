@@ -0,0 +1,61 @@
+// --- Includes ---
+#include <cstdlib>   // For std::atof
+#include <cstring>   // For std::strcmp
+#include <iostream>  // For std::cout, std::cerr
+#include <string>    // For std::string
+
+// Include our custom headers
+#include "gamefiles/Constants.hpp" // TILE_SIZE for the spawn option
+#include "gamefiles/LevelFile.hpp" // Text/CSV loaders and the .dlvl writer
+#include "gamefiles/LevelGenerator.hpp" // @gen: inputs
+
+// Offline level compiler: turns ASCII or CSV maps into the binary .dlvl format that
+// the game and dave_sim can memory-map at startup, enemy spawns included. An input of
+// '@gen:<width>x<height>[:<seed>]' writes a generated level instead, e.g. a 100000x1000 map
+// to play with 'main --stream'.
+//
+//   levelc [--spawn <tileX> <tileY>] <input.txt|input.csv|@gen:...> <output.dlvl>
+
+int main(int argc, char **argv)
+{
+    // --- Parse Arguments ---
+    std::string inputPath;
+    std::string outputPath;
+    bool hasSpawn = false;
+    float spawnTileX = 0.f;
+    float spawnTileY = 0.f;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--spawn") == 0 && i + 2 < argc)
+        {
+            hasSpawn = true;
+            spawnTileX = (float)std::atof(argv[++i]);
+            spawnTileY = (float)std::atof(argv[++i]);
+        }
+        else if (inputPath.empty())
+            inputPath = argv[i];
+        else if (outputPath.empty())
+            outputPath = argv[i];
+        else
+            inputPath.clear(); // Too many arguments, fall through to usage
+    }
+    if (inputPath.empty() || outputPath.empty())
+    {
+        std::cerr << "usage: levelc [--spawn <tileX> <tileY>] <input.txt|input.csv|@gen:<w>x<h>[:<seed>]> <output.dlvl>"
+                  << std::endl;
+        return 1;
+    }
+
+    // --- Compile ---
+    Level level;
+    if (isGeneratedLevelName(inputPath) ? !generateLevelFromName(inputPath, level) : !loadLevel(inputPath, level))
+        return 1;
+    if (hasSpawn)
+        level.spawnPoint = {(spawnTileX + 0.5f) * TILE_SIZE, (spawnTileY + 0.5f) * TILE_SIZE};
+    if (!saveBinaryLevel(outputPath, level))
+        return 1;
+
+    std::cout << inputPath << " -> " << outputPath << " (" << level.size.x << "x" << level.size.y
+              << " tiles, " << level.enemySpawns.size() << " enemy spawns)" << std::endl;
+    return 0;
+}
@@ -2,184 +2,475 @@
 #include <SFML/Graphics.hpp> // For window, view, shapes, text, events, etc.
 #include <optional>          // For event polling
 #include <vector>            // Used indirectly via Level.hpp
-#include <string>            // For std::to_string
+#include <string>            // For command line arguments
 #include <iostream>          // For std::cout, std::cerr
 #include <cmath>             // Used indirectly via Player.cpp
-#include <filesystem>        // For font loading path
+#include <array>             // For the sprite art handles
 #include <algorithm>         // For std::clamp
+#include <utility>           // For std::move
+#include <chrono>            // For snapshot interpolation
 
 // Include our custom headers
 #include "gamefiles/Constants.hpp" // Game constants
+#include "gamefiles/AssetManager.hpp" // Fonts, sprite art and levels, loaded in the background
 #include "gamefiles/Level.hpp"     // Level definition and createSimpleLevel()
+#include "gamefiles/LevelFile.hpp" // Loading levels from disk
 #include "gamefiles/Player.hpp"    // Player definition
+#include "gamefiles/Simulation.hpp" // Fixed-timestep game state
+#include "gamefiles/SimulationThread.hpp" // Runs the simulation alongside rendering
+#include "gamefiles/Pathfinding.hpp"      // Enemy flow fields
+#include "gamefiles/TileMapRenderer.hpp" // Cached tile geometry
+#include "gamefiles/SpriteAtlas.hpp"     // All sprites in one texture
+#include "gamefiles/SpriteBatch.hpp"     // One draw call for the whole world
+#include "gamefiles/WorldRenderer.hpp"   // Entity and player sprites
+#include "gamefiles/Parallax.hpp"        // Background and foreground layers
+#include "gamefiles/GameEvents.hpp"  // Events published by the simulation
+#include "gamefiles/AudioMixer.hpp"  // Sound effects for the events
+#include "gamefiles/AudioOutput.hpp" // Played on the audio device
+#include "gamefiles/InputLog.hpp"    // Input recording and replay
+#include "gamefiles/Hud.hpp"         // Score and other counters
+#include "gamefiles/Profiler.hpp"    // Phase timers
+#include "gamefiles/ProfilerHud.hpp" // F3 performance overlay
 
 // --- Helper Functions (Specific to this main file) ---
 
-// Draws the level tiles that are currently visible within the camera's view.
-// Kept in main.cpp because it needs the RenderWindow.
-void drawLevel(sf::RenderWindow &window, const Level &level)
+// Queues the level tiles that are currently visible within the camera's view.
+// The tile geometry itself is cached per chunk by the TileMapRenderer, so this only
+// copies the vertices of the visible chunks into the batch.
+void drawLevel(SpriteBatch &batch, TileMapRenderer &tileRenderer, const sf::View &view, const Level &level)
 {
-    sf::RectangleShape solidTileShape({(float)TILE_SIZE, (float)TILE_SIZE});
-    solidTileShape.setFillColor(sf::Color::Blue);
-
-    sf::CircleShape coinShape(TILE_SIZE * 0.3f);
-    coinShape.setFillColor(sf::Color::Yellow);
-    coinShape.setOrigin({coinShape.getRadius(), coinShape.getRadius()});
-
-    // View Culling
-    sf::View currentView = window.getView();
-    sf::FloatRect viewBounds;
-    viewBounds.position = currentView.getCenter() - currentView.getSize() / 2.f;
-    viewBounds.size = currentView.getSize();
-    int startX = std::max(0, static_cast<int>(viewBounds.position.x / TILE_SIZE));
-    int endX = std::min((int)level.size.x, static_cast<int>((viewBounds.position.x + viewBounds.size.x) / TILE_SIZE) + 1);
-    int startY = std::max(0, static_cast<int>(viewBounds.position.y / TILE_SIZE));
-    int endY = std::min((int)level.size.y, static_cast<int>((viewBounds.position.y + viewBounds.size.y) / TILE_SIZE) + 1);
-
-    for (int y = startY; y < endY; ++y)
-    {
-        for (int x = startX; x < endX; ++x)
-        {
-            TileType currentTile = level.tiles[y][x];
-            if (currentTile == TileType::Solid)
-            {
-                solidTileShape.setPosition({(float)x * TILE_SIZE, (float)y * TILE_SIZE});
-                window.draw(solidTileShape);
-            }
-            else if (currentTile == TileType::Coin)
-            {
-                coinShape.setPosition({(float)x * TILE_SIZE + TILE_SIZE / 2.f,
-                                       (float)y * TILE_SIZE + TILE_SIZE / 2.f});
-                window.draw(coinShape);
-            }
-        }
-    }
+    tileRenderer.draw(batch, view, level);
 }
 
-// Handles checking for and collecting coins.
-// Kept in main.cpp as it modifies both Player and Level state.
-// Takes a non-const reference to level to allow modifying tiles.
-void handleCoinCollection(Player &player, Level &level)
+// Keeps the camera centered on 'target' without showing anything outside the level.
+sf::Vector2f computeViewCenter(sf::Vector2f target, const sf::View &view, const Level &level)
 {
-    sf::FloatRect playerBounds = player.shape.getGlobalBounds();
-    int leftTile = static_cast<int>((playerBounds.position.x + COLLISION_EPSILON) / TILE_SIZE);
-    int rightTile = static_cast<int>((playerBounds.position.x + playerBounds.size.x - COLLISION_EPSILON) / TILE_SIZE);
-    int topTile = static_cast<int>((playerBounds.position.y + COLLISION_EPSILON) / TILE_SIZE);
-    int bottomTile = static_cast<int>((playerBounds.position.y + playerBounds.size.y - COLLISION_EPSILON) / TILE_SIZE);
-
-    for (int y = topTile; y <= bottomTile; ++y)
-    {
-        for (int x = leftTile; x <= rightTile; ++x)
-        {
-            if (level.getTile(x, y) == TileType::Coin)
-            {
-                player.score++;
-                level.setTile(x, y, TileType::Air); // Remove coin
-                std::cout << "Coin collected! Score: " << player.score << std::endl;
-                // Optional: Add sound effect here
-            }
-        }
-    }
+    float minViewX = view.getSize().x / 2.f;
+    float maxViewX = level.sizePixels.x - view.getSize().x / 2.f;
+    float minViewY = view.getSize().y / 2.f;
+    float maxViewY = level.sizePixels.y - view.getSize().y / 2.f;
+    if (level.sizePixels.x < view.getSize().x)
+        minViewX = maxViewX = level.sizePixels.x / 2.f;
+    if (level.sizePixels.y < view.getSize().y)
+        minViewY = maxViewY = level.sizePixels.y / 2.f;
+    target.x = std::clamp(target.x, minViewX, maxViewX);
+    target.y = std::clamp(target.y, minViewY, maxViewY);
+    return target;
 }
 
 // --- Main Game Function ---
-int main()
+// Usage: main [--stream] [--mute] [--profile-out trace.json|trace.csv] [--record|--replay log.dinp] [level]
+//   level         a .dlvl, .csv or ASCII map; defaults to the built-in level
+//   --stream      stream a .dlvl from disk in chunks instead of loading it whole
+//   --mute        mix the sounds into a null output instead of the audio device
+//   --profile-out record every phase timing and write it on exit (Chrome trace or CSV)
+//   --record      write every tick's input and the final state to a log on exit
+//   --replay      feed a recorded log through the simulation instead of the keyboard,
+//                 then check the final state against the recording (exit code 2 if not identical)
+// Press F3 in game for the performance overlay.
+int main(int argc, char **argv)
 {
+    // --- Command Line ---
+    const std::size_t STREAM_MAX_RESIDENT_CHUNKS = 64; // 64 chunks of 64x64 tiles = 256 KB of tiles
+    const std::size_t PROFILE_MAX_TRACE_SAMPLES = 4000000; // ~10 minutes at 60 fps, 96 MB
+    bool streamLevel = false;
+    bool mute = false;
+    const char *levelPath = nullptr;
+    const char *profileOutPath = nullptr;
+    const char *recordPath = nullptr;
+    const char *replayPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--stream")
+            streamLevel = true;
+        else if (arg == "--mute")
+            mute = true;
+        else if (arg == "--profile-out" && i + 1 < argc)
+            profileOutPath = argv[++i];
+        else if (arg == "--record" && i + 1 < argc)
+            recordPath = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc)
+            replayPath = argv[++i];
+        else
+            levelPath = argv[i];
+    }
+
+    // --- Profiler ---
+    // Always on: a timer costs two clock reads and a ring-buffer write.
+    Profiler &profiler = getProfiler();
+    profiler.setEnabled(true);
+    if (profileOutPath)
+        profiler.startTrace(PROFILE_MAX_TRACE_SAMPLES);
+
     // --- Window Setup ---
     sf::RenderWindow window(sf::VideoMode({WINDOW_WIDTH, WINDOW_HEIGHT}), "Scrolling Platformer");
-    window.setFramerateLimit(60);
+    window.setFramerateLimit(60); // Only caps rendering, the simulation runs on its own fixed tick
 
-    // --- Font and Text Setup (for Score Display) ---
-    sf::Font font;
-    std::filesystem::path fontPath = "arial.ttf"; // Make sure arial.ttf is accessible
-    if (!font.openFromFile(fontPath))
+    // --- Assets ---
+    // Everything is requested up front and loads on worker threads while the window
+    // opens, so startup does not wait for each file in turn; only the level is waited for.
+    // The HUD appears once the font is ready, and the built-in sprites are shown until the
+    // art is. Files saved while the game runs are reloaded in the background.
+    AssetManager assets;
+    assets.setHotReload(true);
+    AssetHandle<sf::Font> font = assets.loadFont("arial.ttf"); // Make sure arial.ttf is accessible
+    std::array<AssetHandle<sf::Image>, (std::size_t)SpriteId::Count> spriteArt;
+    for (std::size_t i = 0; i < spriteArt.size(); ++i)
+        spriteArt[i] = assets.loadImage(std::string("assets/sprites/") + getSpriteName((SpriteId)i) + ".png");
+    AssetHandle<Level> levelAsset; // Streamed levels are opened directly
+    if (levelPath && !streamLevel)
+        levelAsset = assets.loadLevel(levelPath);
+
+    // --- Audio ---
+    // Every sound is synthesized before the game starts. Gameplay events only queue a
+    // request for the mixer, which starts and mixes the sounds on the audio thread.
+    SoundBank soundBank;
+    synthesizeSoundBank(soundBank);
+    AudioMixer audio(soundBank);
+    std::optional<AudioDeviceOutput> audioDevice; // Declared after 'audio', so stopped before it goes
+    NullAudioOutput nullAudio(audio);
+    if (mute)
     {
-        std::cerr << "Error loading font: " << fontPath.string() << std::endl;
+        nullAudio.start();
     }
-    sf::Text scoreText({font, "Score: 0"});
-    scoreText.setFillColor(sf::Color::White);
+    else
+    {
+        audioDevice.emplace(audio);
+        audioDevice->play();
+    }
+
+    // --- HUD Setup ---
+    // Laid out once per font version; counters are patched in place when their value changes.
+    std::optional<Hud> hud;
+    std::optional<ProfilerHud> profilerHud;
+    std::size_t scoreCounter = 0, coinsCounter = 0, fpsCounter = 0;
+    unsigned int hudFontVersion = 0;
+    bool fontErrorShown = false;
+    auto buildHud = [&]()
+    {
+        hud.emplace(font.get(), 30);
+        scoreCounter = hud->addCounter("Score: ", {10.f, 10.f}, 6);
+        coinsCounter = hud->addCounter("Coins left: ", {250.f, 10.f}, 6);
+        fpsCounter = hud->addCounter("FPS: ", {(float)WINDOW_WIDTH - 140.f, 10.f}, 4);
+        bool overlayVisible = profilerHud && profilerHud->visible;
+        profilerHud.emplace(font.get());
+        profilerHud->visible = overlayVisible;
+        hudFontVersion = font.getVersion();
+    };
+    sf::Clock fpsClock;
+    int framesThisSecond = 0;
+
+    // --- Create Simulation (Level and Player) ---
+    // The simulation and the renderer each get their own copy of the level: copies of the
+    // loaded asset, or a streamed level opened twice. The renderer's copy follows the
+    // simulation's through the tile changes in every snapshot.
+    if (levelPath && !streamLevel && !assets.wait(levelAsset))
+    {
+        if (levelAsset.getState() == AssetState::Missing)
+            std::cerr << "Error opening level: " << levelPath << std::endl;
+        return 1;
+    }
+    auto openLevel = [&](Level &level)
+    {
+        level = createSimpleLevel(); // Uses function from Level.cpp
+        if (!levelPath)
+            return true;
+        if (streamLevel)
+            return openStreamedLevel(levelPath, STREAM_MAX_RESIDENT_CHUNKS, level);
+        level = levelAsset.get();
+        return true;
+    };
+    Level startLevel;
+    LevelMirror renderLevel;
+    if (!openLevel(startLevel) || !openLevel(renderLevel.level))
+        return 1;
+    // --- Input Recording / Replay ---
+    InputLog inputLog;         // Being recorded, or being replayed
+    bool replayFinished = false;
+    if (replayPath)
+    {
+        if (!loadInputLog(replayPath, inputLog))
+            return 1;
+        if (inputLog.levelChecksum != computeLevelChecksum(startLevel))
+            std::cerr << "Warning: " << replayPath << " was recorded on a different level" << std::endl;
+    }
+    else if (recordPath)
+    {
+        inputLog.levelChecksum = computeLevelChecksum(startLevel);
+    }
+
+    Simulation sim(std::move(startLevel)); // Moved, so a streamed level keeps its stream
+    GameEventQueue gameEvents;           // Filled on the simulation thread, drained once per frame
+    sim.eventQueue = &gameEvents;
+    FlowFieldWorker pathWorker(sim.navigator.limits); // Enemy flow fields, off the simulation thread
+    sim.pathWorker = &pathWorker;                     // (outlives simThread, declared below)
+    const sf::Vector2f playerSize = sim.player.getSize(sim.entities);
 
-    // --- Create Level and Player ---
-    Level currentLevel = createSimpleLevel();                                   // Uses function from Level.cpp
-    Player player({TILE_SIZE * 1.5f, TILE_SIZE * (currentLevel.size.y - 3.f)}); // Uses constructor from Player.cpp
+    // --- Sprites ---
+    // Art in assets/sprites/<name>.png replaces the built-in sprites of the same name. The
+    // atlas starts out with the built-in art and is rebuilt whenever art finishes loading.
+    SpriteAtlas atlas;
+    if (!atlas.build(SpriteAtlas::SpriteImages{}))
+        return 1;
+    unsigned int atlasArtVersion = 0; // Sum of the art versions the atlas was built from
+    unsigned int levelVersion = levelAsset.getVersion();
+    SpriteBatch batch;                   // Tiles, entities and the player, in one draw call
+    TileMapRenderer tileRenderer(atlas); // Builds tile geometry lazily
+    ParallaxRenderer parallax;           // Mountains, clouds and hills behind, grass in front
+    if (!parallax.build(getDefaultParallaxLayers(), renderLevel.level, window.getSize(), 1234))
+        return 1;
 
     // --- View (Camera) Setup ---
     sf::View gameView({0.f, 0.f}, {(float)WINDOW_WIDTH, (float)WINDOW_HEIGHT});
 
+    // --- Simulation Thread ---
+    // From here until simThread.stop(), 'sim' belongs to the simulation thread: it ticks
+    // while this thread renders the newest snapshot, so a frame's rendering overlaps the
+    // next frame's simulation.
+    SimulationThread simThread(sim);
+    if (replayPath)
+        simThread.setReplay(&inputLog);
+    else if (recordPath)
+        simThread.setRecording(&inputLog);
+    simThread.start();
+    bool jumpPressed = false; // Since the last command sent
+    bool quickSavePressed = false;
+    bool quickLoadPressed = false;
+
     // --- Game Loop ---
     while (window.isOpen())
     {
+        std::uint64_t frameStart = profiler.now();
+
         // --- 1. Event Handling ---
-        std::optional<sf::Event> optEvent;
-        while ((optEvent = window.pollEvent()))
         {
-            if (optEvent->is<sf::Event::Closed>())
-            {
-                window.close();
-            }
-            if (optEvent->is<sf::Event::KeyPressed>())
+            ScopedTimer timer(ProfilePhase::Events);
+            std::optional<sf::Event> optEvent;
+            while ((optEvent = window.pollEvent()))
             {
-                if (auto *keyPressed = optEvent->getIf<sf::Event::KeyPressed>())
+                if (optEvent->is<sf::Event::Closed>())
+                {
+                    window.close();
+                }
+                if (optEvent->is<sf::Event::KeyPressed>())
                 {
-                    if (keyPressed->scancode == sf::Keyboard::Scan::Space || keyPressed->scancode == sf::Keyboard::Scan::Up)
+                    if (auto *keyPressed = optEvent->getIf<sf::Event::KeyPressed>())
                     {
-                        player.jump(); // Calls Player member function
+                        if (keyPressed->scancode == sf::Keyboard::Scan::Space || keyPressed->scancode == sf::Keyboard::Scan::Up)
+                        {
+                            jumpPressed = true; // Applied on the next simulation tick
+                        }
+                        if (keyPressed->scancode == sf::Keyboard::Scan::F3 && profilerHud)
+                        {
+                            profilerHud->toggle();
+                        }
+                        if (keyPressed->scancode == sf::Keyboard::Scan::F5)
+                        {
+                            quickSavePressed = true;
+                        }
+                        if (keyPressed->scancode == sf::Keyboard::Scan::F9)
+                        {
+                            quickLoadPressed = true;
+                        }
                     }
                 }
             }
         }
 
         // --- 2. Input Handling (Continuous) ---
-        player.velocity.x = 0;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left))
+        // Sent to the simulation thread, which applies it from its next tick on.
         {
-            player.velocity.x = -PLAYER_MOVE_SPEED;
+            ScopedTimer timer(ProfilePhase::Input);
+            InputCommand command;
+            command.left = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left);
+            command.right = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right);
+            command.jump = jumpPressed;
+            command.quickSave = quickSavePressed;
+            command.quickLoad = quickLoadPressed;
+            command.rewind = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Backspace);
+            command.viewHalfExtent = gameView.getSize() / 2.f;
+            if (simThread.pushInput(command))
+                jumpPressed = quickSavePressed = quickLoadPressed = false; // Otherwise try again next frame
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right))
+
+        // --- Assets (finished loads and hot reloads; never waits for the disk) ---
         {
-            player.velocity.x = PLAYER_MOVE_SPEED;
+            ScopedTimer timer(ProfilePhase::Assets);
+            assets.update();
+            if (font.isReady() && font.getVersion() != hudFontVersion)
+                buildHud();
+            else if (!font.isReady() && !font.isLoading() && !fontErrorShown)
+            {
+                std::cerr << "Error loading font: " << font.getPath() << std::endl;
+                fontErrorShown = true;
+            }
+            unsigned int artVersion = 0;
+            SpriteAtlas::SpriteImages art{};
+            for (std::size_t i = 0; i < spriteArt.size(); ++i)
+            {
+                artVersion += spriteArt[i].getVersion();
+                if (spriteArt[i].isReady())
+                    art[i] = &spriteArt[i].get();
+            }
+            if (artVersion != atlasArtVersion && atlas.build(art))
+            {
+                atlasArtVersion = artVersion;
+                tileRenderer.invalidate(); // The sprites moved in the atlas
+            }
+            if (levelAsset.getVersion() != levelVersion)
+            {
+                std::cout << levelAsset.getPath() << " changed on disk; restart to play the new version\n";
+                levelVersion = levelAsset.getVersion();
+            }
+        }
+
+        // --- 3. Game State (newest snapshot from the simulation thread) ---
+        const RenderSnapshot &snapshot = simThread.acquireSnapshot();
+        renderLevel.apply(snapshot);
+        simThread.acknowledge(renderLevel.appliedSerial);
+        if (snapshot.finished)
+        {
+            replayFinished = true; // The recording is over; stop and check it
+            window.close();
         }
 
-        // --- 3. Game Logic / Updates ---
-        player.applyGravity();                  // Calls Player member function
-        player.handleCollision(currentLevel);   // Calls Player member function
-        player.handleLevelBounds(currentLevel); // Calls Player member function
-        player.updatePosition();                // Calls Player member function
+        // Report what happened outside the tick loop. '\n' instead of std::endl, so the
+        // console is flushed when its buffer fills rather than on every event.
+        GameEvent gameEvent;
+        while (gameEvents.pop(gameEvent))
+        {
+            audio.post(gameEvent); // Never blocks; a burst past the mixer's queue is dropped
+            switch (gameEvent.type)
+            {
+            case GameEventType::CoinCollected:
+                std::cout << "Coin collected! Score: " << gameEvent.value
+                          << " (" << snapshot.remainingCoins << " left)\n";
+                break;
+            case GameEventType::PlayerFellOut:
+                std::cout << "Player fell out of bounds!\n";
+                break;
+            case GameEventType::PlayerHitEnemy:
+                std::cout << "Player hit an enemy!\n";
+                break;
+            case GameEventType::PlayerHitHazard:
+                std::cout << "Player hit spikes!\n";
+                break;
+            case GameEventType::QuickSaved:
+                std::cout << (gameEvent.value == 0 ? "Quicksaved at tick " : "Could not quicksave at tick ")
+                          << gameEvent.tick << '\n';
+                break;
+            case GameEventType::QuickLoaded:
+                if (gameEvent.value == 0)
+                    std::cout << "Quickloaded tick " << gameEvent.tick << '\n';
+                else
+                    std::cout << "Nothing to quickload (F5 saves)\n";
+                break;
+            }
+        }
 
-        handleCoinCollection(player, currentLevel); // Call helper function
+        // Blend between the last two ticks so motion stays smooth at any frame rate. The
+        // snapshot's latest tick is shown in full one tick after it was published.
+        float sincePublish = std::chrono::duration<float>(std::chrono::steady_clock::now() - snapshot.publishTime).count();
+        float alpha = std::clamp(sincePublish / SIM_TICK_SECONDS, 0.f, 1.f);
+        sf::Vector2f renderPlayerPos = snapshot.previousPlayerPosition +
+                                       (snapshot.playerPosition - snapshot.previousPlayerPosition) * alpha;
 
         // --- Update View Position ---
-        sf::Vector2f viewCenter = player.shape.getPosition();
-        float minViewX = gameView.getSize().x / 2.f;
-        float maxViewX = currentLevel.sizePixels.x - gameView.getSize().x / 2.f;
-        float minViewY = gameView.getSize().y / 2.f;
-        float maxViewY = currentLevel.sizePixels.y - gameView.getSize().y / 2.f;
-        if (currentLevel.sizePixels.x < gameView.getSize().x)
-            minViewX = maxViewX = currentLevel.sizePixels.x / 2.f;
-        if (currentLevel.sizePixels.y < gameView.getSize().y)
-            minViewY = maxViewY = currentLevel.sizePixels.y / 2.f;
-        viewCenter.x = std::clamp(viewCenter.x, minViewX, maxViewX);
-        viewCenter.y = std::clamp(viewCenter.y, minViewY, maxViewY);
-        gameView.setCenter(viewCenter);
-
-        // --- Update Score Text ---
-        scoreText.setString("Score: " + std::to_string(player.score));
+        {
+            ScopedTimer timer(ProfilePhase::Camera);
+            gameView.setCenter(computeViewCenter(renderPlayerPos, gameView, renderLevel.level));
+            // Streamed levels load the chunks around the camera in the background (no-op otherwise).
+            renderLevel.level.streamAround(gameView.getCenter(), gameView.getSize() / 2.f);
+        }
+
+        // --- Update HUD Counters (no-ops unless a value changed) ---
+        framesThisSecond++;
+        if (hud)
+        {
+            hud->setCounter(scoreCounter, snapshot.score);
+            hud->setCounter(coinsCounter, (long long)snapshot.remainingCoins);
+        }
+        if (fpsClock.getElapsedTime().asSeconds() >= 1.f)
+        {
+            long long fps = (long long)(framesThisSecond / fpsClock.restart().asSeconds() + 0.5f);
+            if (hud)
+                hud->setCounter(fpsCounter, fps);
+            framesThisSecond = 0;
+        }
 
         // --- 4. Rendering ---
         window.clear(sf::Color(100, 150, 255));
 
         // Apply the game view for world elements
         window.setView(gameView);
-        drawLevel(window, currentLevel); // Call helper function
-        window.draw(player.shape);       // Draw player shape
+        {
+            ScopedTimer timer(ProfilePhase::DrawLevel);
+            parallax.update(gameView, renderLevel.level); // Draws the columns that came into sight
+            parallax.drawBackground(window);
+            batch.begin();
+            drawLevel(batch, tileRenderer, gameView, renderLevel.level); // Call helper function
+            drawEntities(batch, atlas, snapshot.entities, snapshot.playerEntity);
+            drawPlayer(batch, atlas, renderPlayerPos, playerSize);
+            batch.flush(window, atlas.getTexture());
+            parallax.drawForeground(window);
+        }
 
         // Draw HUD Elements
         window.setView(window.getDefaultView()); // Reset view for HUD
-        scoreText.setPosition({10.f, 10.f});     // Use fixed screen coordinates
-        window.draw(scoreText);
+        if (hud)
+        {
+            hud->draw(window); // One draw call for every counter
+            profilerHud->draw(window);
+        }
 
-        window.display();
+        {
+            ScopedTimer timer(ProfilePhase::Display);
+            window.display();
+        }
+
+        // --- 5. Profiling ---
+        profiler.record(ProfilePhase::Frame, frameStart, profiler.now());
+        profiler.setCounter(ProfileCounter::DrawCalls, batch.getDrawCalls());
+        profiler.setCounter(ProfileCounter::TilesDrawn, tileRenderer.lastTilesDrawn);
+        profiler.setCounter(ProfileCounter::ResidentChunks,
+                            renderLevel.level.stream ? renderLevel.level.stream->getResidentCount() : 0);
+        profiler.setCounter(ProfileCounter::Entities, snapshot.entities.size());
+        profiler.setCounter(ProfileCounter::ParallaxColumns, parallax.getColumnsRedrawn());
+        profiler.endFrame();
+        if (profilerHud)
+            profilerHud->update(profiler);
     }
 
+    simThread.stop(); // 'sim' is ours again
+
+    if (profileOutPath && !profiler.writeTrace(profileOutPath))
+        return 1;
+
+    // --- Finish Recording / Check Replay ---
+    if (recordPath)
+    {
+        inputLog.fingerprint = captureFingerprint(sim);
+        inputLog.hasFingerprint = true;
+        if (!saveInputLog(recordPath, inputLog))
+            return 1;
+        std::cout << "Recorded " << inputLog.getTickCount() << " ticks to " << recordPath << '\n';
+    }
+    if (replayPath && inputLog.hasFingerprint)
+    {
+        if (!replayFinished)
+        {
+            std::cout << "Replay stopped early at tick " << sim.tick << '\n';
+        }
+        else if (captureFingerprint(sim) != inputLog.fingerprint)
+        {
+            std::cout << "Replay diverged: final state differs from the recording\n";
+            return 2;
+        }
+        else
+        {
+            std::cout << "Replay matches the recording (" << sim.tick << " ticks)\n";
+        }
+    }
     return 0;
 }